@@ -0,0 +1,78 @@
+// Benchmark for the opcode dispatch of Engine::operate()
+
+// Build once as-is (computed goto) and once with the switch for comparison:
+// g++ -O2 -I../src -I../stdlib Dispatch_Bench.cpp ../src/*.cpp ../stdlib/*.cpp -o bench_goto
+// g++ -O2 -DUNDEF_COPPER_ENABLE_COMPUTED_GOTO -I../src -I../stdlib Dispatch_Bench.cpp ../src/*.cpp ../stdlib/*.cpp -o bench_switch
+
+#include <stdio.h>
+#include <time.h>
+#include "../src/Copper.h"
+#include "../stdlib/StringInStream.h"
+
+using namespace Cu;
+
+// Loop-heavy script: Mostly gotos, conditions, variable access, and literals, with a few calls.
+static const char* benchScript =
+	"i = 0\n"
+	"total = 0\n"
+	"obj = [ alpha=1 beta=2 ]\n"
+	"myadd = [p q] { ret( +(p: q:) ) }\n"
+	"loop {\n"
+	"	if ( gte(i: 300000) ) { stop }\n"
+	"	i = +(i: 1)\n"
+	"	a = obj.alpha\n"
+	"	b = obj.beta\n"
+	"	s = \"text\"\n"
+	"	d = 1.5\n"
+	"	t = true\n"
+	"	if ( t: ) { a = b } elif ( false ) { b = a } else { s = \"other\" }\n"
+	"	if ( equal(a: 0) ) { total = myadd(total: a:) }\n"
+	"}\n";
+
+float runOnce() {
+	Engine engine;
+	StringInStream stream(benchScript);
+	clock_t timeStart, timeEnd;
+
+	timeStart = clock();
+	while ( engine.run(stream) == EngineResult::Ok );
+	timeEnd = clock();
+
+	printf("\nDISPATCH: Member cache hits = %lu, misses = %lu",
+		(unsigned long)engine.getMemberCacheHits(), (unsigned long)engine.getMemberCacheMisses());
+	return ((float)(timeEnd-timeStart)/CLOCKS_PER_SEC)*1000;
+}
+
+int main() {
+	unsigned int rounds = 5;
+	unsigned int r = 0;
+	float best = 0;
+	float clockTime;
+
+#ifdef COPPER_ENABLE_COMPUTED_GOTO
+	printf("\nDISPATCH: computed goto");
+#else
+	printf("\nDISPATCH: switch");
+#endif
+
+	for ( ; r < rounds; ++r ) {
+		clockTime = runOnce();
+		printf("\nDISPATCH: Round %u clock time = %f", r, clockTime);
+		if ( r == 0 || clockTime < best )
+			best = clockTime;
+	}
+	printf("\nDISPATCH: Best clock time = %f\n", best);
+
+	// Totals of all runs
+	unsigned long allocations = 0;
+	unsigned long slabs = 0;
+	unsigned long size = util::SlabAllocator::Granularity;
+	for ( ; size <= util::SlabAllocator::MaxBlockSize; size += util::SlabAllocator::Granularity ) {
+		allocations += util::SlabAllocator::getStats(size).allocations;
+		slabs += util::SlabAllocator::getStats(size).slabs;
+	}
+	printf("DISPATCH: Slab allocations = %lu, slabs = %lu, oversized allocations = %lu\n",
+		allocations, slabs, (unsigned long)util::SlabAllocator::getOversizedStats().allocations);
+
+	return 0;
+}
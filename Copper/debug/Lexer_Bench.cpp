@@ -0,0 +1,121 @@
+// Benchmark for loading large scripts through the byte streams
+
+// g++ -O2 -I../src -I../stdlib Lexer_Bench.cpp ../src/*.cpp ../stdlib/*.cpp -o lexer_bench
+// Build also with -DUNDEF_COPPER_ENABLE_SIMD_SCANNING (or with -mavx2) to compare the byte scanning.
+
+#include <stdio.h>
+#include <time.h>
+#include "../src/Copper.h"
+#include "../stdlib/StringInStream.h"
+#include "../stdlib/FileInStream.h"
+
+using namespace Cu;
+
+// Gives the lexer one byte at a time, as streams without the block interface do.
+class ByteByByteStream : public ByteStream {
+	StringInStream source;
+public:
+	ByteByByteStream( const util::String&  code )
+		: source(code)
+	{}
+
+	virtual char getNextByte() {
+		return source.getNextByte();
+	}
+
+	virtual bool atEOS() {
+		return source.atEOS();
+	}
+};
+
+static const char* benchFile = "lexer_bench.cu";
+
+// Generated script: Assignments, calls, strings, and comments, like generated data scripts.
+util::String makeMixedScript( unsigned int  pLines ) {
+	util::CharList code;
+	unsigned int i = 0;
+	for (; i < pLines; ++i) {
+		code.append("# Generated entry #\n");
+		code.append("entry_value = +(1 2)\n");
+		code.append("entry_name = \"some \\\"quoted\\\" text\"\n");
+		code.append("entry = [ alpha=entry_value: beta=entry_name: ]\n");
+	}
+	return util::String(code);
+}
+
+// Generated script: Long, indented comments around a little code
+util::String makeCommentScript( unsigned int  pLines ) {
+	util::CharList code;
+	unsigned int i = 0;
+	for (; i < pLines; ++i) {
+		code.append("\t\t# This entry was generated. It has a long explanation of what it holds, \n");
+		code.append("\t\t  which continues over several lines and even has \\# escaped characters \n");
+		code.append("\t\t  in it, as the documentation of generated scripts often does. #\n");
+		code.append("\t\tentry = 1\n");
+	}
+	return util::String(code);
+}
+
+// Generated script: Long string literals, some with escape characters
+util::String makeStringScript( unsigned int  pLines ) {
+	util::CharList code;
+	unsigned int i = 0;
+	for (; i < pLines; ++i) {
+		code.append("entry = \"A long text entry that was generated for the benchmark, which is long enough to cross several vectors\"\n");
+		code.append("entry = \"Another text entry,\\n this time with a \\\"quote\\\" and a line break in it\"\n");
+	}
+	return util::String(code);
+}
+
+float runOnce( ByteStream&  pStream, const char*  pName ) {
+	Engine engine;
+	clock_t timeStart, timeEnd;
+	EngineResult::Value result;
+
+	timeStart = clock();
+	do {
+		result = engine.run(pStream);
+	} while ( result == EngineResult::Ok );
+	timeEnd = clock();
+
+	const float clockTime = ((float)(timeEnd-timeStart)/CLOCKS_PER_SEC)*1000;
+	printf("\nLEXER: %s clock time = %f (%s)", pName, clockTime,
+		result == EngineResult::Done ? "done" : "error");
+	return clockTime;
+}
+
+void runScript( const util::String&  pScript, const char*  pName ) {
+	printf("\nLEXER: %s script size = %lu bytes", pName, (unsigned long)pScript.size());
+
+	FILE* file = fopen(benchFile, "w");
+	if ( ! file ) {
+		printf("\nLEXER: Could not write %s\n", benchFile);
+		return;
+	}
+	fwrite(pScript.c_str(), 1, pScript.size(), file);
+	fclose(file);
+
+	ByteByByteStream byteStream(pScript);
+	runOnce(byteStream, "Byte by byte");
+
+	StringInStream stringStream(pScript);
+	runOnce(stringStream, "String blocks");
+
+	FileInStream fileStream(benchFile);
+	runOnce(fileStream, "File blocks");
+
+	remove(benchFile);
+}
+
+int main() {
+#ifdef COPPER_ENABLE_SIMD_SCANNING
+	printf("\nLEXER: SIMD scanning");
+#else
+	printf("\nLEXER: Scalar scanning");
+#endif
+	runScript(makeMixedScript(20000), "Mixed");
+	runScript(makeCommentScript(20000), "Comment");
+	runScript(makeStringScript(20000), "String");
+	printf("\n");
+	return 0;
+}
@@ -18,9 +18,13 @@ struct Int {
 
 void test1();
 void test2();
+void test3();
+void test4();
 
 int main() {
 	test1();
+	test3();
+	test4();
 
 	return 0;
 }
@@ -97,3 +101,128 @@ void test2() {
 	clockTime = ((float)(timeEnd-timeStart)/CLOCKS_PER_SEC)*1000;
 	printf("\nLIST: Clock time for %i elements = %f\n", cap, clockTime);
 }
+
+
+// The old String::keyValue(), kept here for comparison.
+uint byteSumKey( const String& pName ) {
+	uint i = 0;
+	uint key = 0;
+	for ( ; i < pName.size(); ++i ) {
+		key += (uint)pName[i];
+	}
+	return key;
+}
+
+// Creates names that resemble the members of a large script object,
+// such as "item_12", "item_21", "meti_12", etc.
+void makeMemberName( String& pOut, unsigned int pIndex ) {
+	static const char* prefixes[] = { "item_", "meti_", "time_", "emit_", "mite_" };
+	String number;
+	number.fromInt( (int)(pIndex / 5) );
+	pOut = prefixes[pIndex % 5];
+	pOut += number;
+}
+
+unsigned int countCollisions( const List<uint>& pKeys, uint pMask ) {
+	// Number of keys whose initial bucket was already taken by an earlier key
+	unsigned int collisions = 0;
+	List<uint>::ConstIter i = pKeys.constStart();
+	List<uint>::ConstIter j = pKeys.constStart();
+	uint index = 0;
+	uint index2;
+	if ( ! i.has() )
+		return 0;
+	do {
+		j = pKeys.constStart();
+		for ( index2 = 0; index2 < index; ++index2, j.next() ) {
+			if ( (*i & pMask) == (*j & pMask) ) {
+				++collisions;
+				break;
+			}
+		}
+		++index;
+	} while ( i.next() );
+	return collisions;
+}
+
+// Collision and probe-length benchmark
+void test3() {
+	RobinHoodHash<Int> hashTable(64);
+	List<uint> keys;
+	List<uint> oldKeys;
+	String name;
+	unsigned int i = 0;
+	unsigned int cap = 500;
+	clock_t timeStart, timeEnd;
+
+	for ( ; i < cap; ++i ) {
+		makeMemberName(name, i);
+		keys.push_back( name.keyValue() );
+		oldKeys.push_back( byteSumKey(name) );
+		hashTable.insert(name, Int(i));
+	}
+
+	const uint mask = hashTable.getSize() - 1;
+	printf("\nPROBE: %u names in table of size %lu", cap, (unsigned long)hashTable.getSize());
+	printf("\nPROBE: Initial-bucket collisions: old key = %u, new key = %u",
+		countCollisions(oldKeys, mask), countCollisions(keys, mask));
+
+	uint maxDelay = 0;
+	uint totalDelay = 0;
+	for ( i = 0; i < hashTable.getSize(); ++i ) {
+		if ( hashTable.get(i) ) {
+			totalDelay += hashTable.getDelay(i);
+			if ( hashTable.getDelay(i) > maxDelay )
+				maxDelay = hashTable.getDelay(i);
+		}
+	}
+	printf("\nPROBE: Average probe length = %f, max probe length = %lu",
+		(float)totalDelay / (float)hashTable.getOccupancy(), (unsigned long)maxDelay);
+
+	unsigned int found = 0;
+	unsigned int rounds = 200;
+	unsigned int r = 0;
+	timeStart = clock();
+	for ( ; r < rounds; ++r ) {
+		for ( i = 0; i < cap; ++i ) {
+			makeMemberName(name, i);
+			if ( hashTable.getBucketData(name) )
+				++found;
+		}
+	}
+	timeEnd = clock();
+
+	float clockTime = ((float)(timeEnd-timeStart)/CLOCKS_PER_SEC)*1000;
+	printf("\nPROBE: Clock time for %u lookups = %f (found %u)\n", cap * rounds, clockTime, found);
+}
+
+// Erasure check: Remaining names must still be reachable after backward-shift deletion.
+void test4() {
+	RobinHoodHash<Int> hashTable(8);
+	String name;
+	unsigned int i = 0;
+	unsigned int cap = 300;
+	unsigned int errors = 0;
+	RobinHoodHash<Int>::BucketData* bucketData;
+
+	for ( ; i < cap; ++i ) {
+		makeMemberName(name, i);
+		hashTable.insert(name, Int(i));
+	}
+	for ( i = 0; i < cap; i += 3 ) {
+		makeMemberName(name, i);
+		hashTable.erase(name);
+	}
+	for ( i = 0; i < cap; ++i ) {
+		makeMemberName(name, i);
+		bucketData = hashTable.getBucketData(name);
+		if ( i % 3 == 0 ) {
+			if ( bucketData )
+				++errors;
+		} else if ( !bucketData || bucketData->item.i != i ) {
+			++errors;
+		}
+	}
+	printf("\nERASE: Occupancy = %lu (expected %u), errors = %u\n",
+		(unsigned long)hashTable.getOccupancy(), cap - (cap + 2) / 3, errors);
+}
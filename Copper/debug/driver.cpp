@@ -105,7 +105,7 @@ void testScope() {
 
 	std::printf("Adding variable 'a'.\n");
 
-	scope->addVariable(name_a);
+	scope->addVariable(Cu::Symbol(name_a));
 
 	std::printf("Checking if variable 'a' exists.\n");
 
@@ -121,7 +121,7 @@ void testScope() {
 
 	std::printf("Getting existing variable.\n");
 
-	scope->getVariable(name_a, var_a);
+	scope->getVariable(Cu::Symbol(name_a), var_a);
 
 	std::printf("Variable 'a' &=%p\n", (void*)var_a);
 
@@ -139,7 +139,7 @@ void testScope() {
 
 	std::printf("Getting non-existent variable 'b'.\n");
 
-	scope->getVariable(name_b, var_b);
+	scope->getVariable(Cu::Symbol(name_b), var_b);
 
 	std::printf("Variable 'b' found. &=%p\n", (void*)var_b);
 
@@ -155,7 +155,7 @@ void testScope() {
 				std::printf("obtained function...: &=%p\n", func_a);
 
 				std::printf("Getting non-existent variable 'c' from 'a'.\n");
-				func_a->getPersistentScope().getVariable(name_c, var_c);
+				func_a->getPersistentScope().getVariable(Cu::Symbol(name_c), var_c);
 				std::printf("Variable 'c' from 'a', &=%p\n", var_c);
 			} else {
 				std::printf("No function.\n");
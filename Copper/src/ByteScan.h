@@ -0,0 +1,100 @@
+// Copyright 2016 Nicolaus Anderson
+
+#ifndef UTIL_BYTE_SCAN_H
+#define UTIL_BYTE_SCAN_H
+
+// Uncomment to have the lexer skip whitespace and search comments and strings 16 bytes at a time
+// using SSE2. Comments and strings are searched 32 bytes at a time if compiled for AVX2 (such as
+// with -mavx2). Without it (or without GCC or Clang), bytes are checked one at a time.
+#define COPPER_ENABLE_SIMD_SCANNING
+
+#ifdef UNDEF_COPPER_ENABLE_SIMD_SCANNING
+#undef COPPER_ENABLE_SIMD_SCANNING
+#endif
+
+#if defined(COPPER_ENABLE_SIMD_SCANNING) && !( defined(__SSE2__) && defined(__GNUC__) )
+#undef COPPER_ENABLE_SIMD_SCANNING
+#endif
+
+#ifdef COPPER_ENABLE_SIMD_SCANNING
+#include <emmintrin.h>
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+#endif
+
+namespace util {
+
+// Returns the first byte in [pStart, pEnd) equal to either given byte, or pEnd if there is none.
+inline const char*
+findEitherByte( const char* pStart, const char* pEnd, const char pFirst, const char pSecond ) {
+	const char* p = pStart;
+#ifdef COPPER_ENABLE_SIMD_SCANNING
+	unsigned int mask;
+#ifdef __AVX2__
+	const __m256i first32 = _mm256_set1_epi8(pFirst);
+	const __m256i second32 = _mm256_set1_epi8(pSecond);
+	__m256i bytes32;
+	for (; pEnd - p >= 32; p += 32 ) {
+		bytes32 = _mm256_loadu_si256((const __m256i*)p);
+		mask = (unsigned int)_mm256_movemask_epi8(
+			_mm256_or_si256( _mm256_cmpeq_epi8(bytes32, first32), _mm256_cmpeq_epi8(bytes32, second32) )
+		);
+		if ( mask != 0 )
+			return p + __builtin_ctz(mask);
+	}
+#endif
+	const __m128i first = _mm_set1_epi8(pFirst);
+	const __m128i second = _mm_set1_epi8(pSecond);
+	__m128i bytes;
+	for (; pEnd - p >= 16; p += 16 ) {
+		bytes = _mm_loadu_si128((const __m128i*)p);
+		mask = (unsigned int)_mm_movemask_epi8(
+			_mm_or_si128( _mm_cmpeq_epi8(bytes, first), _mm_cmpeq_epi8(bytes, second) )
+		);
+		if ( mask != 0 )
+			return p + __builtin_ctz(mask);
+	}
+#endif
+	for (; p != pEnd; ++p ) {
+		if ( *p == pFirst || *p == pSecond )
+			return p;
+	}
+	return pEnd;
+}
+
+// Returns the first byte in [pStart, pEnd) that is not a space, tab, newline, vertical tab,
+// form feed, or carriage return, or pEnd if there is none.
+// (Unlike Engine::isWhitespace(), null bytes are not skipped.)
+inline const char*
+skipWhitespaceBytes( const char* pStart, const char* pEnd ) {
+	const char* p = pStart;
+#ifdef COPPER_ENABLE_SIMD_SCANNING
+	// Tab to carriage return are the bytes 9 to 13, so (byte - 9) is at most 4 for them.
+	unsigned int mask;
+	__m128i bytes;
+	__m128i offset;
+	const __m128i nine = _mm_set1_epi8(9);
+	const __m128i four = _mm_set1_epi8(4);
+	const __m128i space = _mm_set1_epi8(' ');
+	for (; pEnd - p >= 16; p += 16 ) {
+		bytes = _mm_loadu_si128((const __m128i*)p);
+		offset = _mm_sub_epi8(bytes, nine);
+		mask = (unsigned int)_mm_movemask_epi8(
+			_mm_or_si128( _mm_cmpeq_epi8(_mm_min_epu8(offset, four), offset), _mm_cmpeq_epi8(bytes, space) )
+		);
+		mask = ~mask & 0xFFFF; // Bytes that are not whitespace
+		if ( mask != 0 )
+			return p + __builtin_ctz(mask);
+	}
+#endif
+	for (; p != pEnd; ++p ) {
+		if ( *p != ' ' && ( *p < '\t' || *p > '\r' ) )
+			return p;
+	}
+	return pEnd;
+}
+
+}
+
+#endif
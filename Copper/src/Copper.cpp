@@ -30,47 +30,539 @@ static const char CONSTANT_COMMENT_TOKEN = '#';
 static const char CONSTANT_STRING_TOKEN = '"';
 static const char CONSTANT_ESCAPE_CHARACTER_TOKEN = '\\';
 
-// *********** OPERATION PROCESSING BASE COMPONENTS **********
+// ******* Reserved names *******
+// Interned first by the SymbolTable, so the symbol of each has its index + 1 as its ID.
+static const ReservedName RESERVED_NAMES[] = {
+	{ CONSTANT_END_MAIN, ReservedName::Keyword, TT_end_main, SystemFunction::_unset },
+	{ CONSTANT_EXIT, ReservedName::Keyword, TT_exit, SystemFunction::_unset },
+	{ CONSTANT_TOKEN_IF, ReservedName::Keyword, TT_if, SystemFunction::_unset },
+	{ CONSTANT_TOKEN_ELIF, ReservedName::Keyword, TT_elif, SystemFunction::_unset },
+	{ CONSTANT_TOKEN_ELSE, ReservedName::Keyword, TT_else, SystemFunction::_unset },
+	{ CONSTANT_TOKEN_LOOP, ReservedName::Keyword, TT_loop, SystemFunction::_unset },
+	{ CONSTANT_TOKEN_ENDLOOP, ReservedName::Keyword, TT_endloop, SystemFunction::_unset },
+	{ CONSTANT_TOKEN_LOOPSKIP, ReservedName::Keyword, TT_skip, SystemFunction::_unset },
+	{ CONSTANT_TOKEN_TRUE, ReservedName::Keyword, TT_boolean_true, SystemFunction::_unset },
+	{ CONSTANT_TOKEN_FALSE, ReservedName::Keyword, TT_boolean_false, SystemFunction::_unset },
+
+	{ CONSTANT_TOKEN_OWN, ReservedName::Own, TT_name, SystemFunction::_unset },
+	{ CONSTANT_TOKEN_IS_OWNER, ReservedName::IsOwner, TT_name, SystemFunction::_unset },
+	{ CONSTANT_TOKEN_IS_PTR, ReservedName::IsPointer, TT_name, SystemFunction::_unset },
+
+	{ CONSTANT_FUNCTION_RETURN, ReservedName::Builtin, TT_name, SystemFunction::_return },
+	{ "are_available", ReservedName::Builtin, TT_name, SystemFunction::_are_available },
+	{ "not", ReservedName::Builtin, TT_name, SystemFunction::_not },
+	{ "all", ReservedName::Builtin, TT_name, SystemFunction::_all },
+	{ "any", ReservedName::Builtin, TT_name, SystemFunction::_any },
+	{ "nall", ReservedName::Builtin, TT_name, SystemFunction::_nall },
+	{ "none", ReservedName::Builtin, TT_name, SystemFunction::_none },
+	{ "xall", ReservedName::Builtin, TT_name, SystemFunction::_xall },
+	{ "are_fn", ReservedName::Builtin, TT_name, SystemFunction::_are_fn },
+	{ "are_empty", ReservedName::Builtin, TT_name, SystemFunction::_are_empty },
+	{ "are_same", ReservedName::Builtin, TT_name, SystemFunction::_are_same },
+	{ "member", ReservedName::Builtin, TT_name, SystemFunction::_member },
+	{ "member_count", ReservedName::Builtin, TT_name, SystemFunction::_member_count },
+	{ "is_member", ReservedName::Builtin, TT_name, SystemFunction::_is_member },
+	{ "set_member", ReservedName::Builtin, TT_name, SystemFunction::_set_member },
+	{ "member_list", ReservedName::Builtin, TT_name, SystemFunction::_member_list },
+	{ "union", ReservedName::Builtin, TT_name, SystemFunction::_union },
+	{ "type_of", ReservedName::Builtin, TT_name, SystemFunction::_type },
+	{ "are_same_type", ReservedName::Builtin, TT_name, SystemFunction::_are_same_type },
+	{ "are_type", ReservedName::Builtin, TT_name, SystemFunction::_are_type },
+	{ "equal_type_value", ReservedName::Builtin, TT_name, SystemFunction::_equal_type_value },
+	{ "typename_of", ReservedName::Builtin, TT_name, SystemFunction::_typename },
+	{ "have_same_typename", ReservedName::Builtin, TT_name, SystemFunction::_have_same_typename },
+	{ "ret_type", ReservedName::Builtin, TT_name, SystemFunction::_function_return_type },
+	{ "are_nil", ReservedName::Builtin, TT_name, SystemFunction::_are_nil },
+	{ "are_bool", ReservedName::Builtin, TT_name, SystemFunction::_are_bool },
+	{ "are_string", ReservedName::Builtin, TT_name, SystemFunction::_are_string },
+	{ "are_list", ReservedName::Builtin, TT_name, SystemFunction::_are_list },
+	{ "are_number", ReservedName::Builtin, TT_name, SystemFunction::_are_number },
+	{ "are_int", ReservedName::Builtin, TT_name, SystemFunction::_are_integer },
+	{ "are_dcml", ReservedName::Builtin, TT_name, SystemFunction::_are_decimal },
+	{ "assert", ReservedName::Builtin, TT_name, SystemFunction::_assert },
+
+	{ "copy_of", ReservedName::Builtin, TT_name, SystemFunction::_copy },
+	{ "realize", ReservedName::Builtin, TT_name, SystemFunction::_construct_from_type },
+	{ "new", ReservedName::Builtin, TT_name, SystemFunction::_construct_from_name },
+	{ "xwsv", ReservedName::Builtin, TT_name, SystemFunction::_execute_with_alt_super },
+	{ "share_body", ReservedName::Builtin, TT_name, SystemFunction::_share_body },
+
+	{ "list", ReservedName::Builtin, TT_name, SystemFunction::_make_list },
+	{ "length", ReservedName::Builtin, TT_name, SystemFunction::_list_size },
+	{ "append", ReservedName::Builtin, TT_name, SystemFunction::_list_append },
+	{ "prepend", ReservedName::Builtin, TT_name, SystemFunction::_list_prepend },
+	{ "insert", ReservedName::Builtin, TT_name, SystemFunction::_list_insert },
+	{ "item_at", ReservedName::Builtin, TT_name, SystemFunction::_list_get_item },
+	{ "erase", ReservedName::Builtin, TT_name, SystemFunction::_list_remove },
+	{ "dump", ReservedName::Builtin, TT_name, SystemFunction::_list_clear },
+	{ "swap", ReservedName::Builtin, TT_name, SystemFunction::_list_swap },
+	{ "replace", ReservedName::Builtin, TT_name, SystemFunction::_list_replace },
+	{ "sublist", ReservedName::Builtin, TT_name, SystemFunction::_list_sublist },
+
+	{ "matching", ReservedName::Builtin, TT_name, SystemFunction::_string_match },
+	{ "concat", ReservedName::Builtin, TT_name, SystemFunction::_string_concat },
+
+	{ "equal", ReservedName::Builtin, TT_name, SystemFunction::_num_equal },
+	{ "gt", ReservedName::Builtin, TT_name, SystemFunction::_num_greater_than },
+	{ "gte", ReservedName::Builtin, TT_name, SystemFunction::_num_greater_or_equal },
+	{ "lt", ReservedName::Builtin, TT_name, SystemFunction::_num_less_than },
+	{ "lte", ReservedName::Builtin, TT_name, SystemFunction::_num_less_or_equal },
+	{ "abs", ReservedName::Builtin, TT_name, SystemFunction::_num_abs },
+#ifdef COPPER_ENABLE_EXTENDED_NAME_SET
+	{ "+", ReservedName::Builtin, TT_name, SystemFunction::_num_add },
+	{ "-", ReservedName::Builtin, TT_name, SystemFunction::_num_subtract },
+	{ "*", ReservedName::Builtin, TT_name, SystemFunction::_num_multiply },
+	{ "/", ReservedName::Builtin, TT_name, SystemFunction::_num_divide },
+	{ "%", ReservedName::Builtin, TT_name, SystemFunction::_num_modulus },
+	{ "++", ReservedName::Builtin, TT_name, SystemFunction::_num_incr },
+	{ "--", ReservedName::Builtin, TT_name, SystemFunction::_num_decr },
+#else
+	// Alternative names
+	{ "add", ReservedName::Builtin, TT_name, SystemFunction::_num_add },
+	{ "sbtr", ReservedName::Builtin, TT_name, SystemFunction::_num_subtract },
+	{ "mult", ReservedName::Builtin, TT_name, SystemFunction::_num_multiply },
+	{ "divd", ReservedName::Builtin, TT_name, SystemFunction::_num_divide },
+	{ "mod", ReservedName::Builtin, TT_name, SystemFunction::_num_modulus },
+	{ "incr", ReservedName::Builtin, TT_name, SystemFunction::_num_incr },
+	{ "decr", ReservedName::Builtin, TT_name, SystemFunction::_num_decr },
+#endif
+
+};
 
-OpcodeContainer::OpcodeContainer( Opcode* pCode )
-	: code(pCode)
+static const UInteger RESERVED_NAME_COUNT = sizeof(RESERVED_NAMES) / sizeof(ReservedName);
+
+// *********** SYMBOLS **********
+
+SymbolTable::SymbolTable()
+	: ids(256)
+	, names(REAL_NULL)
+	, count(0)
+	, capacity(256)
 {
-	// Unfortunately, making opcodes independent would make the creation of loops messier.
-#ifdef COPPER_PARSER_LEVEL_MESSAGES
-	std::printf(
-		"[DEBUG: OpcodeContainer cstor(code): code = %p, type = %u, pCode= %p\n",
-		(void*)code, (unsigned)(code->getType()), (void*)pCode);
-#endif
-	code->ref();
+	names = new String*[capacity];
+	// The empty name is always the first symbol, as expected by Symbol()
+	intern(String());
+	UInteger  i = 0;
+	for (; i < RESERVED_NAME_COUNT; ++i) {
+		intern(String(RESERVED_NAMES[i].name));
+	}
+	// The table may be recreated, so names used for static symbols need fixed IDs too.
+	intern(String(CONSTANT_FUNCTION_SELF));
+	intern(String(CONSTANT_FUNCTION_SUPER));
 }
 
-OpcodeContainer::OpcodeContainer( const OpcodeContainer& pOther ) // Used only for transmission in lists
-	: code( pOther.code )
-{
+SymbolTable::~SymbolTable() {
+	UInteger i = 0;
+	for (; i < count; ++i) {
+		delete names[i];
+	}
+	delete[] names;
+}
+
+SymbolTable*  SymbolTable::shared = REAL_NULL;
+UInteger  SymbolTable::ownerCount = 0;
+
+SymbolTable&
+SymbolTable::get() {
+	if ( ! shared )
+		shared = new SymbolTable();
+	return *shared;
+}
+
+SymbolTable::Owner::Owner() {
+	get();
+	++ownerCount;
+}
+
+SymbolTable::Owner::Owner( const Owner&  CU_UNUSED_ARG(pOther) ) {
+	get();
+	++ownerCount;
+}
+
+SymbolTable::Owner::~Owner() {
+	--ownerCount;
+	if ( ownerCount == 0 ) {
+		delete shared;
+		shared = REAL_NULL;
+	}
+}
+
+UInteger
+SymbolTable::intern( const String&  pName ) {
+	RobinHoodHash<UInteger>::BucketData*  bucketData = ids.getBucketData(pName);
+	if ( bucketData )
+		return bucketData->item;
+
+	if ( count == capacity ) {
+		String**  oldNames = names;
+		UInteger  i = 0;
+		capacity *= 2;
+		names = new String*[capacity];
+		for (; i < count; ++i) {
+			names[i] = oldNames[i];
+		}
+		delete[] oldNames;
+	}
+	names[count] = new String(pName);
+	ids.insert(pName, count);
+	return count++;
+}
+
+UInteger
+SymbolTable::intern( const StringSpan&  pName ) {
+	RobinHoodHash<UInteger>::BucketData*  bucketData = ids.findBucketData(pName);
+	if ( bucketData )
+		return bucketData->item;
+	return intern( String(pName) );
+}
+
+UInteger
+SymbolTable::find( const StringSpan&  pName ) {
+	RobinHoodHash<UInteger>::BucketData*  bucketData = ids.findBucketData(pName);
+	if ( bucketData )
+		return bucketData->item;
+	return 0;
+}
+
+const String&
+SymbolTable::getName( UInteger  pId ) const {
+	return *(names[pId]);
+}
+
+UInteger
+SymbolTable::size() const {
+	return count;
+}
+
+Symbol::Symbol( const String&  pName )
+	: id( SymbolTable::get().intern(pName) )
+{}
+
+Symbol::Symbol( const char*  pName )
+	: id( SymbolTable::get().intern(String(pName)) )
+{}
+
+Symbol::Symbol( const StringSpan&  pName )
+	: id( SymbolTable::get().intern(pName) )
+{}
+
+bool
+Symbol::find( const String&  pName, Symbol&  pSymbol ) {
+	pSymbol.id = SymbolTable::get().find( StringSpan(pName.c_str(), pName.size()) );
+	return pSymbol.id != 0 || pName.size() == 0;
+}
+
+const String&
+Symbol::getName() const {
+	return SymbolTable::get().getName(id);
+}
+
+const ReservedName*
+Symbol::getReservedName() const {
+	// The empty name (ID 0) wraps around to fail the test
+	if ( id - 1 < RESERVED_NAME_COUNT )
+		return &(RESERVED_NAMES[id - 1]);
+	return REAL_NULL;
+}
+
+// Interned right after the reserved names (see SymbolTable())
+static const Symbol SYMBOL_FUNCTION_SELF( Symbol::fromId(RESERVED_NAME_COUNT + 1) );
+static const Symbol SYMBOL_FUNCTION_SUPER( Symbol::fromId(RESERVED_NAME_COUNT + 2) );
+
+// *********** OPERATION PROCESSING BASE COMPONENTS **********
+
+OpStrand::OpStrand()
+	: codes(REAL_NULL)
+	, count(0)
+	, capacity(0)
+	, constants(REAL_NULL)
+	, constantCount(0)
+	, constantCapacity(0)
+{}
+
+OpStrand::~OpStrand() {
+	uint i = 0;
+	for (; i < count; ++i) {
+		releaseConstant(codes[i]);
+	}
+	delete[] codes;
+	delete[] constants;
+}
+
+// Returns true if the instruction data is stored in the constant pool
+static bool
+usesOpConstant( unsigned char  dtype ) {
+	switch( dtype ) {
+	case Opcode::ODT_Name:
+	case Opcode::ODT_Address:
+	case Opcode::ODT_Integer:
+	case Opcode::ODT_Decimal:
+	case Opcode::ODT_Body:
+		return true;
+	default:
+		return false;
+	}
+}
+
+uint
+OpStrand::addConstant( const OpConstant&  pConstant ) {
+	if ( constantCount == constantCapacity ) {
+		constantCapacity = ( constantCapacity == 0 ? 8 : constantCapacity * 2 );
+		OpConstant* newConstants = new OpConstant[constantCapacity];
+		if ( constantCount > 0 )
+			std::memcpy( (void*)newConstants, (void*)constants, sizeof(OpConstant) * constantCount );
+		delete[] constants;
+		constants = newConstants;
+	}
+	constants[constantCount] = pConstant;
+	return constantCount++;
+}
+
+void
+OpStrand::releaseConstant( const Instruction&  pCode ) {
+	switch( pCode.dtype ) {
+	case Opcode::ODT_Name:
+		delete constants[pCode.operand].string;
+		break;
+	case Opcode::ODT_Address:
+		constants[pCode.operand].address->deref();
+		break;
+	case Opcode::ODT_Integer:
+	case Opcode::ODT_Decimal:
+		constants[pCode.operand].literal->deref();
+		break;
+	case Opcode::ODT_Body:
+		constants[pCode.operand].body->deref();
+		break;
+	default:
+		break;
+	}
+}
+
+uint
+OpStrand::push_back( Opcode* pCode ) {
 #ifdef COPPER_PARSER_LEVEL_MESSAGES
-	std::printf("[DEBUG: OpcodeContainer cstor copy: code = %p\n", (void*)code);
-#endif
-	code->ref();
+	std::printf("[DEBUG: OpStrand::push_back: code = %p, type = %u\n",
+		(void*)pCode, (unsigned)(pCode->getType()));
+#endif
+	Instruction  code;
+	OpConstant  constant;
+	code.type = (unsigned char)pCode->getType();
+	code.dtype = (unsigned char)pCode->getDataType();
+	code.argCount = 0;
+	code.operand = 0;
+
+	switch( pCode->getDataType() ) {
+	case Opcode::ODT_Name:
+		constant.string = new String( pCode->getNameData() );
+		code.operand = (int)addConstant(constant);
+		break;
+
+	case Opcode::ODT_Symbol:
+		code.operand = (int)pCode->getSymbolData().getId();
+		break;
+
+	case Opcode::ODT_Address:
+		constant.address = pCode->getAddressData();
+		constant.address->ref();
+		code.operand = (int)addConstant(constant);
+		if ( pCode->getType() == Opcode::SysCall )
+			code.argCount = (unsigned short)pCode->getArgCount();
+		break;
+
+	case Opcode::ODT_Integer:
+		constant.literal = new IntegerObject( pCode->getIntegerData() );
+		((NumericObject*)constant.literal)->setConstant();
+		code.operand = (int)addConstant(constant);
+		break;
+
+	case Opcode::ODT_Decimal:
+		constant.literal = new DecimalNumObject( pCode->getDecimalData() );
+		((NumericObject*)constant.literal)->setConstant();
+		code.operand = (int)addConstant(constant);
+		break;
+
+	case Opcode::ODT_Body:
+		constant.body = pCode->getBody();
+		constant.body->ref();
+		code.operand = (int)addConstant(constant);
+		break;
+
+	case Opcode::ODT_CodeIndex:
+		code.operand = pCode->getJump();
+		break;
+
+	default:
+		break;
+	}
+
+	if ( count == capacity ) {
+		capacity = ( capacity == 0 ? 16 : capacity * 2 );
+		Instruction* newCodes = new Instruction[capacity];
+		if ( count > 0 )
+			std::memcpy( (void*)newCodes, (void*)codes, sizeof(Instruction) * count );
+		delete[] codes;
+		codes = newCodes;
+	}
+	codes[count] = code;
+	return count++;
 }
 
-OpcodeContainer::~OpcodeContainer() {
-	code->deref();
+void
+OpStrand::setJump( uint pGotoIndex, uint pTargetIndex ) {
+	codes[pGotoIndex].operand = (int)pTargetIndex - (int)pGotoIndex;
 }
 
-//const Opcode*
-Opcode*
-OpcodeContainer::getOp() {
-	return code;
+void
+OpStrand::setType( uint pIndex, Opcode::Type pType ) {
+	codes[pIndex].type = (unsigned char)pType;
 }
 
-/*
-static OpcodeContainer
-OpcodeContainer::indie( Opcode* pCode ) {
-	OpcodeContainer out(pCode);
-	pCode->deref();
-	return out;
+void
+OpStrand::removeRange( uint pStart, uint pCount ) {
+	if ( pCount == 0 || pStart + pCount > count )
+		return;
+	const uint  end = pStart + pCount;
+	uint  i = pStart;
+	for (; i < end; ++i) {
+		releaseConstant(codes[i]);
+	}
+	// Jump offsets are relative, so they must be recalculated for the new positions.
+	// A goto continues at the instruction after its target, so targets within the removed
+	// instructions become the instruction before them.
+	int  target;
+	int  newIndex;
+	for ( i = 0; i < count; ++i ) {
+		if ( i == pStart ) {
+			i = end - 1;
+			continue;
+		}
+		if ( ! codes[i].isJump() )
+			continue;
+		target = (int)i + codes[i].operand;
+		newIndex = ( i < pStart ) ? (int)i : (int)(i - pCount);
+		if ( target >= (int)end )
+			target -= (int)pCount;
+		else if ( target >= (int)pStart )
+			target = (int)pStart - 1;
+		codes[i].operand = target - newIndex;
+	}
+	std::memmove( (void*)(codes + pStart), (void*)(codes + end), sizeof(Instruction) * (count - end) );
+	count -= pCount;
+}
+
+bool
+OpStrand::replaceWithValue( uint pStart, uint pEnd, Object* pValue ) {
+	if ( isNull(pValue) || pEnd < pStart || pEnd >= count )
+		return false;
+	Instruction  code;
+	OpConstant  constant;
+	bool  hasConstant = true;
+	code.dtype = (unsigned char)Opcode::ODT_Unset;
+	code.argCount = 0;
+	code.operand = 0;
+
+	if ( isBoolObject(*pValue) ) {
+		code.type = (unsigned char)( ((BoolObject*)pValue)->getValue() ? Opcode::CreateBoolTrue : Opcode::CreateBoolFalse );
+		hasConstant = false;
+	}
+	else if ( isStringObject(*pValue) ) {
+		code.type = (unsigned char)Opcode::CreateString;
+		code.dtype = (unsigned char)Opcode::ODT_Name;
+		constant.string = new String( ((StringObject*)pValue)->getString() );
+	}
+	else if ( pValue->getType() == ObjectType::Numeric && ((NumericObject*)pValue)->getNumberType() == ObjectType::Integer ) {
+		code.type = (unsigned char)Opcode::CreateInteger;
+		code.dtype = (unsigned char)Opcode::ODT_Integer;
+		constant.literal = new IntegerObject( unboxInteger(*(NumericObject*)pValue) );
+		((NumericObject*)constant.literal)->setConstant();
+	}
+	else if ( pValue->getType() == ObjectType::Numeric && ((NumericObject*)pValue)->getNumberType() == ObjectType::DecimalNum ) {
+		code.type = (unsigned char)Opcode::CreateDecimal;
+		code.dtype = (unsigned char)Opcode::ODT_Decimal;
+		constant.literal = new DecimalNumObject( unboxDecimal(*(NumericObject*)pValue) );
+		((NumericObject*)constant.literal)->setConstant();
+	}
+	else {
+		return false;
+	}
+
+	// Reuse the last constant slot of the replaced instructions so that the constants stay in
+	// instruction order (which removeUpTo() relies on).
+	int  slot = -1;
+	uint  i = pStart;
+	for (; i <= pEnd; ++i) {
+		if ( usesOpConstant(codes[i].dtype) ) {
+			slot = codes[i].operand;
+			releaseConstant(codes[i]);
+		}
+		codes[i].dtype = (unsigned char)Opcode::ODT_Unset; // Already released
+	}
+	if ( hasConstant ) {
+		if ( slot >= 0 )
+			constants[slot] = constant;
+		else
+			slot = (int)addConstant(constant);
+		code.operand = slot;
+	}
+	codes[pStart] = code;
+	removeRange(pStart + 1, pEnd - pStart);
+	return true;
+}
+
+void
+OpStrand::removeUpTo( uint pIndex ) {
+	if ( pIndex == 0 || pIndex > count )
+		return;
+	uint i = 0;
+	for (; i < pIndex; ++i) {
+		releaseConstant(codes[i]);
+	}
+	count -= pIndex;
+	std::memmove( (void*)codes, (void*)(codes + pIndex), sizeof(Instruction) * count );
+
+	// Constants are added in instruction order, so the ones still in use begin with
+	// the constant of the first remaining instruction that has one.
+	uint firstConstant = constantCount;
+	for ( i = 0; i < count; ++i ) {
+		if ( usesOpConstant(codes[i].dtype) ) {
+			firstConstant = (uint)codes[i].operand;
+			break;
+		}
+	}
+	if ( firstConstant == 0 )
+		return;
+	for (; i < count; ++i) {
+		if ( usesOpConstant(codes[i].dtype) )
+			codes[i].operand -= (int)firstConstant;
+	}
+	constantCount -= firstConstant;
+	std::memmove( (void*)constants, (void*)(constants + firstConstant), sizeof(OpConstant) * constantCount );
+}
+
+void
+OpStrand::compact() {
+	if ( count < capacity ) {
+		Instruction* newCodes = REAL_NULL;
+		if ( count > 0 ) {
+			newCodes = new Instruction[count];
+			std::memcpy( (void*)newCodes, (void*)codes, sizeof(Instruction) * count );
+		}
+		delete[] codes;
+		codes = newCodes;
+		capacity = count;
+	}
+	if ( constantCount < constantCapacity ) {
+		OpConstant* newConstants = REAL_NULL;
+		if ( constantCount > 0 ) {
+			newConstants = new OpConstant[constantCount];
+			std::memcpy( (void*)newConstants, (void*)constants, sizeof(OpConstant) * constantCount );
+		}
+		delete[] constants;
+		constants = newConstants;
+		constantCapacity = constantCount;
+	}
 }
-*/
 
 //--------------
 
@@ -79,6 +571,7 @@ Opcode::Opcode( Opcode::Type pType )
 	, dtype(ODT_Unset)
 	, name()
 	, address(REAL_NULL)
+	, symbol()
 {
 	switch(type)
 	{
@@ -90,7 +583,7 @@ Opcode::Opcode( Opcode::Type pType )
 	case Goto:
 	case ConditionalGoto:
 		dtype = ODT_CodeIndex;
-		data.target = REAL_NULL; // REQUIRED! (copy constructer depends on this)
+		data.jump = 0; // Set by the parser once the target is known
 		break;
 
 	// WARNING: It is assumed that the other values are initialized via setters
@@ -109,12 +602,14 @@ Opcode::Opcode( Opcode::Type pType, const String&  pStrValue, bool  onAddress )
 	, dtype(ODT_Unset)
 	, name()
 	, address(REAL_NULL)
+	, symbol()
 {
 	if ( onAddress ) {
 		dtype = ODT_Address;
 		//address.push_back(pStrValue);
 		address = new VarAddress();
-		address->push_back(pStrValue);
+		address->push_back(Symbol(pStrValue));
+		data.argCount = 0;
 	} else {
 		dtype = ODT_Name;
 		name = pStrValue;
@@ -126,14 +621,39 @@ Opcode::Opcode( Opcode::Type pType, const String&  pStrValue, bool  onAddress )
 #endif
 }
 
+Opcode::Opcode( Opcode::Type pType, const Symbol&  pSymbol, bool  onAddress )
+	: type(pType)
+	, dtype(ODT_Unset)
+	, name()
+	, address(REAL_NULL)
+	, symbol()
+{
+	if ( onAddress ) {
+		dtype = ODT_Address;
+		address = new VarAddress();
+		address->push_back(pSymbol);
+		data.argCount = 0;
+	} else {
+		dtype = ODT_Symbol;
+		symbol = pSymbol;
+	}
+
+#ifdef COPPER_DEBUG_ADDRESS
+	if ( dtype == ODT_Address )
+		address->print();
+#endif
+}
+
 //Opcode::Opcode( Opcode::Type pType, const VarAddress&  pAddress )
 Opcode::Opcode( Opcode::Type pType, VarAddress*  pAddress )
 	: type(pType)
 	, dtype(ODT_Address)
 	, name()
 	, address(pAddress)
+	, symbol()
 {
 	address->ref();
+	data.argCount = 0;
 
 #ifdef COPPER_DEBUG_ADDRESS
 	if ( dtype == ODT_Address )
@@ -146,6 +666,7 @@ Opcode::Opcode( const Opcode& pOther )
 	, dtype(pOther.dtype)
 	, name()
 	, address(REAL_NULL)
+	, symbol()
 {
 	switch( pOther.dtype )
 	{
@@ -153,9 +674,14 @@ Opcode::Opcode( const Opcode& pOther )
 		name = pOther.name;
 		break;
 
+	case ODT_Symbol:
+		symbol = pOther.symbol;
+		break;
+
 	case ODT_Address:
 		address = pOther.address;
 		address->ref();
+		data.argCount = pOther.data.argCount;
 #ifdef COPPER_DEBUG_ADDRESS
 		address->print();
 #endif
@@ -174,9 +700,7 @@ Opcode::Opcode( const Opcode& pOther )
 		throw CopyBodyOpcodeException();
 
 	case ODT_CodeIndex:
-		data.target = REAL_NULL;
-		if ( data.target )
-			data.target = new OpStrandIter(*(pOther.data.target));
+		data.jump = pOther.data.jump;
 		break;
 
 	default:
@@ -190,9 +714,6 @@ Opcode::~Opcode() {
 
 	else if ( dtype == ODT_Address )
 		address->deref();
-		
-	else if ( dtype == ODT_CodeIndex )
-		delete data.target;
 }
 
 Opcode::Type
@@ -205,14 +726,19 @@ Opcode::setType( Opcode::Type pType ) {
 	type = pType;
 }
 
+Opcode::DataType
+Opcode::getDataType() const {
+	return dtype;
+}
+
 void
-Opcode::appendAddressData( const String&  pString ) {
+Opcode::appendAddressData( const Symbol&  pSymbol ) {
 	dtype = ODT_Address;
 	//address.push_back(pString);
 	if ( !address ) {
 		address = new VarAddress();
 	}
-	address->push_back(pString);
+	address->push_back(pSymbol);
 #ifdef COPPER_DEBUG_ADDRESS
 		address->print();
 #endif
@@ -229,12 +755,18 @@ Opcode::getAddressData() {
 	return address;
 }
 
-// Used for function parameters and so forth
+// Used for strings
 String
 Opcode::getNameData() const {
 	return name;
 }
 
+// Used for function parameters and member names
+const Symbol&
+Opcode::getSymbolData() const {
+	return symbol;
+}
+
 void
 Opcode::setIntegerData( Integer value ) {
 	dtype = ODT_Integer;
@@ -274,17 +806,19 @@ Opcode::getBody() const {
 	return data.body;
 }
 
+int
+Opcode::getJump() const {
+	return data.jump;
+}
+
 void
-Opcode::setTarget( const OpStrandIter pTarget ) {
-	dtype = ODT_CodeIndex;
-	data.target = new OpStrandIter(pTarget);
+Opcode::setArgCount( UInteger  count ) {
+	data.argCount = count;
 }
 
-OpStrandIter&
-Opcode::getOpStrandIter() {
-	if ( isNull(data.target) )
-		throw NullGotoOpcodeException();
-	return *(data.target);
+UInteger
+Opcode::getArgCount() const {
+	return data.argCount;
 }
 
 //--------------
@@ -293,10 +827,12 @@ Body::Body()
 	: state(Raw)
 	, tokens()
 	, codes(new OpStrand())
+	, layout(new FrameLayout())
 {}
 
 Body::~Body() {
 	codes->deref();
+	layout->deref();
 }
 
 void
@@ -333,6 +869,11 @@ Body::getOpcodeStrand() {
 	return codes;
 }
 
+FrameLayout*
+Body::getLayout() {
+	return layout;
+}
+
 bool
 Body::isEmpty() const {
 	return (! tokens.has()) && ( notNull(codes) ? codes->size() == 0 : true );
@@ -362,6 +903,12 @@ Body::compile_internal(Engine* engine) {
 		return false;
 	case ParseResult::Done:
 		tokens.clear();
+#ifdef COPPER_ENABLE_BODY_OPTIMIZER
+		engine->optimize(*codes);
+#endif
+		codes->compact(); // The body will not change from here on
+		buildLayout();
+		markTailCalls();
 		state = Ready;
 		return true;
 	// to get -Wall to stop griping:
@@ -370,6 +917,68 @@ Body::compile_internal(Engine* engine) {
 	}
 }
 
+// Gives a slot to "this", "super", and the first name of every address used in the body.
+// Parameters are found this way too, since their names are used in the body. (Unused parameters
+// are kept in the scope of the frame.)
+void
+Body::buildLayout() {
+	layout->add(SYMBOL_FUNCTION_SELF);
+	layout->add(SYMBOL_FUNCTION_SUPER);
+	VarAddress*  address;
+	uint  i = 0;
+	for (; i < codes->size(); ++i) {
+		if ( codes->get(i).dtype != Opcode::ODT_Address )
+			continue;
+		address = codes->getAddressData( codes->get(i) );
+		// Built-in functions can never be variables
+		if ( address->sysFuncValue != SystemFunction::_unset )
+			continue;
+		address->localSlot = layout->add( address->first() );
+	}
+}
+
+// Marks the user function calls whose result becomes the result of the body.
+// The engine runs these in place of the body instead of on top of it.
+void
+Body::markTailCalls() {
+	uint  i = 0;
+	for (; i < codes->size(); ++i) {
+		if ( codes->get(i).getType() == Opcode::FuncFound_finishCall && isTailPosition(i + 1) )
+			codes->setType(i, Opcode::FuncFound_finishTailCall);
+	}
+}
+
+// Checks if nothing but the end of the body or "ret" of the last result follows the given index.
+// Terminals do nothing and forward gotos are followed. Backward gotos are loops.
+bool
+Body::isTailPosition( uint pIndex ) const {
+	uint  i = pIndex;
+	while ( i < codes->size() ) {
+		const Instruction&  code = codes->get(i);
+		switch( code.getType() ) {
+		case Opcode::Terminal:
+			++i;
+			break;
+
+		case Opcode::Goto:
+			if ( code.getJump() <= 0 )
+				return false;
+			i += (uint)code.getJump();
+			break;
+
+		case Opcode::SysCall_setParam:
+			return i + 1 < codes->size()
+				&& codes->get(i + 1).getType() == Opcode::SysCall
+				&& codes->get(i + 1).argCount == 1
+				&& codes->getAddressData( codes->get(i + 1) )->sysFuncValue == SystemFunction::_return;
+
+		default:
+			return false;
+		}
+	}
+	return true;
+}
+
 // ******* Function definitions *******
 
 Function::Function()
@@ -377,12 +986,11 @@ Function::Function()
 	, body()
 	, params()
 	, result()
-	, persistentScope(new Scope())
+	, persistentScope(REAL_NULL)
 {
 #ifdef COPPER_VAR_LEVEL_MESSAGES
 	std::printf("[DEBUG: Function constructor 1 [%p]\n", (void*)this);
 #endif
-	body.setWithoutRef(new Body());
 }
 
 Function::Function(const Function& pOther)
@@ -395,14 +1003,16 @@ Function::Function(const Function& pOther)
 #ifdef COPPER_VAR_LEVEL_MESSAGES
 	std::printf("[DEBUG: Function constructor 2 (const Function&) [%p]\n", (void*)this);
 #endif
-	persistentScope->ref();
+	if ( notNull(persistentScope) )
+		persistentScope->ref();
 }
 
 Function::~Function() {
 #ifdef COPPER_VAR_LEVEL_MESSAGES
 	std::printf("[DEBUG: Function::~Function [%p]\n", (void*)this);
 #endif
-	persistentScope->deref();
+	if ( notNull(persistentScope) )
+		persistentScope->deref();
 }
 
 Function& Function::operator=(const Function& pOther) {
@@ -413,18 +1023,37 @@ Function& Function::operator=(const Function& pOther) {
 	body = pOther.body;
 	params = pOther.params;
 	result = pOther.result;
-	*persistentScope = *(pOther.persistentScope);
+	copyScopeFrom(pOther);
 	return *this;
 }
 
+void
+Function::copyScopeFrom( const Function& other ) {
+	if ( notNull(other.persistentScope) ) {
+		getPersistentScope() = *(other.persistentScope);
+	}
+	else if ( notNull(persistentScope) ) {
+		// The other function has no members, but this scope may be shared, so it must be emptied.
+		Scope emptyScope(1);
+		*persistentScope = emptyScope;
+	}
+}
+
 Scope&
 Function::getPersistentScope() {
 #ifdef COPPER_VAR_LEVEL_MESSAGES
 	std::printf("[DEBUG: Function::getPersistentScope [%p]\n", (void*)this);
 #endif
+	if ( isNull(persistentScope) )
+		persistentScope = new Scope();
 	return *persistentScope;
 }
 
+bool
+Function::hasPersistentScope() const {
+	return notNull(persistentScope);
+}
+
 void
 Function::set( Function& other, bool copyScope ) {
 #ifdef COPPER_VAR_LEVEL_MESSAGES
@@ -434,7 +1063,7 @@ Function::set( Function& other, bool copyScope ) {
 	body = other.body;
 	params = other.params; // If params is changed to a pointer, this has to be changed to a copy
 	if ( copyScope )
-		*persistentScope = *(other.persistentScope);
+		copyScopeFrom(other);
 	Object* rs;
 	if ( other.result.obtain(rs) ) {
 		result.setWithoutRef( rs->copy() );
@@ -442,7 +1071,7 @@ Function::set( Function& other, bool copyScope ) {
 }
 
 void
-Function::addParam( const String pName ) {
+Function::addParam( const Symbol& pName ) {
 	params.push_back(pName);
 }
 
@@ -792,124 +1421,195 @@ Variable::getCopy() {
 
 NumericObject::NumericObject()
 	: Object(NumericObject::object_type)
+	, constant(false)
+	, numberType(ObjectType::Numeric)
+{}
+
+NumericObject::NumericObject( ObjectType::Value  pNumberType )
+	: Object(NumericObject::object_type)
+	, constant(false)
+	, numberType(pNumberType)
 {}
 
 NumericObject::~NumericObject()
 {}
 
 //--------------------------------------
+// Arithmetic on unboxed values, shared by the number classes and the engine's number chains
 
-bool
-IntegerObject::supportsInterface( ObjectType::Value  typeValue ) const {
-	switch ( typeValue ) {
-	case NumericObject::object_type: return true;
-	case ObjectType::Integer: return true;
-	default: break;
+Integer
+unboxInteger( const NumericObject&  number ) {
+	// Qualified calls are not virtual
+	switch ( number.getNumberType() ) {
+	case ObjectType::Integer:
+		return ((const IntegerObject&)number).IntegerObject::getIntegerValue();
+	case ObjectType::DecimalNum:
+		return ((const DecimalNumObject&)number).DecimalNumObject::getIntegerValue();
+	default:
+		return number.getIntegerValue();
 	}
-	return false;
-}
-
-void
-IntegerObject::setValue( const NumericObject&  other ) {
-	value = other.getIntegerValue();
-}
-
-bool
-IntegerObject::isEqualTo( const NumericObject&  other ) {
-	return value == other.getIntegerValue();
 }
 
-bool
-IntegerObject::isGreaterThan( const NumericObject&  other ) {
-	return value > other.getIntegerValue();
-}
-
-bool
-IntegerObject::isGreaterOrEqual( const NumericObject&  other ) {
-	return value >= other.getIntegerValue();
-}
-
-NumericObject*
-IntegerObject::absValue() const {
-	return new IntegerObject( value >= 0 ? value : -value );
+Decimal
+unboxDecimal( const NumericObject&  number ) {
+	switch ( number.getNumberType() ) {
+	case ObjectType::Integer:
+		return ((const IntegerObject&)number).IntegerObject::getDecimalValue();
+	case ObjectType::DecimalNum:
+		return ((const DecimalNumObject&)number).DecimalNumObject::getDecimalValue();
+	default:
+		return number.getDecimalValue();
+	}
 }
 
 // Thanks to pmg for the bounds tests for integers.
 // https://stackoverflow.com/questions/199333/how-to-detect-integer-overflow-in-c-c
 // and thanks to Franz D. for observing more detection is needed for multiplication.
 
-NumericObject*
-IntegerObject::add( const NumericObject&  other ) {
+Integer
+integerAdd( Integer  value, Integer  oi ) {
 #ifdef ENABLE_COPPER_NUMERIC_BOUNDS_CHECKS
-	Integer oi = other.getIntegerValue();
 	// Detect overflow
 	if ( oi > 0 && value > std::numeric_limits<Integer>::max() - oi ) {
-		return new IntegerObject(std::numeric_limits<Integer>::max());
+		return std::numeric_limits<Integer>::max();
 	}
 	// Detect underflow
 	if ( oi < 0 && value < std::numeric_limits<Integer>::min() - oi ) {
-		return new IntegerObject(std::numeric_limits<Integer>::min());
+		return std::numeric_limits<Integer>::min();
 	}
 #endif
-	return new IntegerObject(value + other.getIntegerValue());
+	return value + oi;
 }
 
-NumericObject*
-IntegerObject::subtract( const NumericObject&  other ) {
+Integer
+integerSubtract( Integer  value, Integer  oi ) {
 #ifdef ENABLE_COPPER_NUMERIC_BOUNDS_CHECKS
-	Integer oi = other.getIntegerValue();
 	// detect overflow
 	if ( oi < 0 && value > std::numeric_limits<Integer>::max() + oi ) {
-		return new IntegerObject(std::numeric_limits<Integer>::max());
+		return std::numeric_limits<Integer>::max();
 	}
 	// detect underflow
 	if ( oi > 0 && value < std::numeric_limits<Integer>::min() + oi ) {
-		return new IntegerObject(std::numeric_limits<Integer>::min());
+		return std::numeric_limits<Integer>::min();
 	}
 #endif
-	return new IntegerObject(value - other.getIntegerValue());
+	return value - oi;
 }
 
-NumericObject*
-IntegerObject::multiply( const NumericObject&  other ) {
+Integer
+integerMultiply( Integer  value, Integer  oi ) {
 #ifdef ENABLE_COPPER_NUMERIC_BOUNDS_CHECKS
-	Integer oi = other.getIntegerValue();
-	if ( oi < 0 )
-		oi = -oi; // Get absolute value
-	if ( oi != 0 ) {
+	Integer absOi = oi;
+	if ( absOi < 0 )
+		absOi = -absOi; // Get absolute value
+	if ( absOi != 0 ) {
 		// detect overflow
-		if ( value > std::numeric_limits<Integer>::max() / oi ) {
-			return new IntegerObject(std::numeric_limits<Integer>::max());
+		if ( value > std::numeric_limits<Integer>::max() / absOi ) {
+			return std::numeric_limits<Integer>::max();
 		}
-		if ( value < std::numeric_limits<Integer>::min() / oi ) {
-			return new IntegerObject(std::numeric_limits<Integer>::min());
+		if ( value < std::numeric_limits<Integer>::min() / absOi ) {
+			return std::numeric_limits<Integer>::min();
 		}
 	}
 #endif
-	return new IntegerObject(value * other.getIntegerValue());
+	return value * oi;
 }
 
-NumericObject*
-IntegerObject::divide( const NumericObject&  other ) {
+Integer
+integerDivide( Integer  value, Integer  oi ) {
 #ifdef ENABLE_COPPER_NUMERIC_BOUNDS_CHECKS
-	Integer oi = other.getIntegerValue();
 	if ( oi == 0 ) {
 		if ( value > 0 ) {
-			return new IntegerObject( std::numeric_limits<Integer>::max() );
+			return std::numeric_limits<Integer>::max();
 		}
 		if ( value == 0 ) {
-			return new IntegerObject( 0 );
+			return 0;
 		}
 		// else
-		return new IntegerObject( std::numeric_limits<Integer>::min() );
+		return std::numeric_limits<Integer>::min();
 	}
 #endif
-	return new IntegerObject(value / other.getIntegerValue());
+	return value / oi;
+}
+
+Decimal
+decimalDivide( Decimal  value, Decimal  od ) {
+#ifdef ENABLE_COPPER_NUMERIC_BOUNDS_CHECKS
+	if ( iszero(od) ) {
+		if ( value > 0 ) {
+			return std::numeric_limits<Decimal>::infinity();
+		}
+		if ( iszero(value) ) {
+			return 0;
+		} else {
+			return - std::numeric_limits<Decimal>::infinity();
+		}
+	}
+#endif
+	return value / od;
+}
+
+//--------------------------------------
+
+bool
+IntegerObject::supportsInterface( ObjectType::Value  typeValue ) const {
+	switch ( typeValue ) {
+	case NumericObject::object_type: return true;
+	case ObjectType::Integer: return true;
+	default: break;
+	}
+	return false;
+}
+
+void
+IntegerObject::setValue( const NumericObject&  other ) {
+	if ( ! constant )
+		value = unboxInteger(other);
+}
+
+bool
+IntegerObject::isEqualTo( const NumericObject&  other ) {
+	return value == unboxInteger(other);
+}
+
+bool
+IntegerObject::isGreaterThan( const NumericObject&  other ) {
+	return value > unboxInteger(other);
+}
+
+bool
+IntegerObject::isGreaterOrEqual( const NumericObject&  other ) {
+	return value >= unboxInteger(other);
+}
+
+NumericObject*
+IntegerObject::absValue() const {
+	return new IntegerObject( value >= 0 ? value : -value );
+}
+
+NumericObject*
+IntegerObject::add( const NumericObject&  other ) {
+	return new IntegerObject( integerAdd(value, unboxInteger(other)) );
+}
+
+NumericObject*
+IntegerObject::subtract( const NumericObject&  other ) {
+	return new IntegerObject( integerSubtract(value, unboxInteger(other)) );
+}
+
+NumericObject*
+IntegerObject::multiply( const NumericObject&  other ) {
+	return new IntegerObject( integerMultiply(value, unboxInteger(other)) );
+}
+
+NumericObject*
+IntegerObject::divide( const NumericObject&  other ) {
+	return new IntegerObject( integerDivide(value, unboxInteger(other)) );
 }
 
 NumericObject*
 IntegerObject::modulus(const NumericObject&  other ) {
-	return new IntegerObject(value % other.getIntegerValue());
+	return new IntegerObject(value % unboxInteger(other));
 }
 
 //--------------------------------------
@@ -934,22 +1634,23 @@ DecimalNumObject::supportsInterface( ObjectType::Value  typeValue ) const {
 
 void
 DecimalNumObject::setValue( const NumericObject&  other ) {
-	value = other.getDecimalValue();
+	if ( ! constant )
+		value = unboxDecimal(other);
 }
 
 bool
 DecimalNumObject::isEqualTo( const NumericObject&  other ) {
-	return value == other.getDecimalValue();
+	return value == unboxDecimal(other);
 }
 
 bool
 DecimalNumObject::isGreaterThan( const NumericObject&  other ) {
-	return value > other.getDecimalValue();
+	return value > unboxDecimal(other);
 }
 
 bool
 DecimalNumObject::isGreaterOrEqual( const NumericObject&  other ) {
-	return value >= other.getDecimalValue();
+	return value >= unboxDecimal(other);
 }
 
 NumericObject*
@@ -959,40 +1660,27 @@ DecimalNumObject::absValue() const {
 
 NumericObject*
 DecimalNumObject::add( const NumericObject&  other ) {
-	return new DecimalNumObject(value + other.getDecimalValue());
+	return new DecimalNumObject(value + unboxDecimal(other));
 }
 
 NumericObject*
 DecimalNumObject::subtract( const NumericObject&  other ) {
-	return new DecimalNumObject(value - other.getDecimalValue());
-}
-
-NumericObject*
-DecimalNumObject::multiply( const NumericObject&  other ) {
-	return new DecimalNumObject(value * other.getDecimalValue());
+	return new DecimalNumObject(value - unboxDecimal(other));
 }
 
 NumericObject*
-DecimalNumObject::divide( const NumericObject&  other ) {
-#ifdef ENABLE_COPPER_NUMERIC_BOUNDS_CHECKS
-	Decimal od = other.getDecimalValue();
-	if ( iszero(od) ) {
-		if ( value > 0 ) {
-			return DecimalNumObject( std::numeric_limits<Decimal>::infinity() );
-		}
-		if ( iszero(value) ) {
-			return DecimalNumObject( 0 );
-		} else {
-			return DecimalNumObject( - std::numeric_limits<Decimal>::infinity() );
-		}
-	}
-#endif
-	return new DecimalNumObject(value / other.getDecimalValue());
+DecimalNumObject::multiply( const NumericObject&  other ) {
+	return new DecimalNumObject(value * unboxDecimal(other));
+}
+
+NumericObject*
+DecimalNumObject::divide( const NumericObject&  other ) {
+	return new DecimalNumObject( decimalDivide(value, unboxDecimal(other)) );
 }
 
 NumericObject*
 DecimalNumObject::modulus(const NumericObject&  other ) {
-	return new IntegerObject(Integer(value) % other.getIntegerValue());
+	return new IntegerObject(Integer(value) % unboxInteger(other));
 }
 
 //--------------------------------------
@@ -1303,44 +1991,86 @@ RefVariableStorage::copy() {
 
 //--------------------------------------
 
-void Scope::copyAsgnFromHashTable( RobinHoodHash<RefVariableStorage>& pTable ) {
+// Stamps are shared by all scopes so that a stamp is never reused, even by a scope
+// created where a destroyed one was.
+static uint nextScopeStamp() {
+	static uint lastStamp = 0;
+	return ++lastStamp;
+}
+
+void Scope::copyAsgnFromHashTable( RobinHoodHash<RefVariableStorage, Symbol>& pTable ) {
 #ifdef COPPER_SCOPE_LEVEL_MESSAGES
 	std::printf("[DEBUG: Scope::copyAsgnFromHashTable\n");
 #endif
 	CHECK_SCOPE_HASH_NULL(robinHoodTable)
 
 	delete robinHoodTable;
-	robinHoodTable = new RobinHoodHash<RefVariableStorage>(pTable.getSize());
-	RobinHoodHash<RefVariableStorage>::Bucket*  rawBuckets = pTable.getTablePointer();
+	robinHoodTable = new RobinHoodHash<RefVariableStorage, Symbol>(pTable.getSize());
+	stamp = nextScopeStamp();
+	RobinHoodHash<RefVariableStorage, Symbol>::BucketData*  bucketData;
 	uint i=0;
 	// Manually copy to ensure copy of variables, not merely sharing when storage is "copied"
 	for (; i < pTable.getSize(); ++i) {
-		if ( rawBuckets[i].data ) {
+		bucketData = pTable.get(i);
+		if ( bucketData ) {
 			robinHoodTable->insert(
-				rawBuckets[i].data->name,
-				((RefVariableStorage&)(rawBuckets[i].data->item)).copy()
+				bucketData->name,
+				((RefVariableStorage&)(bucketData->item)).copy()
 			);
 		}
 	}
 }
 
+// Shared by Scope and StackFrame
+static void
+setVariableToVariable( Variable* var, Variable* pSourceVariable, bool pReuseStorage ) {
+	if ( notNull(pSourceVariable) ) {
+		var->set(pSourceVariable, pReuseStorage);
+	} else {
+		// Default
+		var->reset();
+	}
+}
+
+// Shared by Scope and StackFrame
+static void
+setVariableToObject( Variable* var, Object* pObject, bool pReuseStorage ) {
+	if ( notNull(pObject) ) {
+		switch(pObject->getType()) {
+		case ObjectType::Function:
+			// Save directly
+			var->setFunc( (FunctionObject*)pObject, pReuseStorage );
+			break;
+		//case ObjectType::Data:
+		default:
+			// Save as the return of a function
+			var->setFuncReturn(pObject);
+			break;
+		}
+	} else {
+		var->reset();
+	}
+}
+
 Scope::Scope( UInteger  pTableSize )
 	: robinHoodTable(REAL_NULL)
+	, stamp(nextScopeStamp())
 {
 #ifdef COPPER_SCOPE_LEVEL_MESSAGES
 	std::printf("[DEBUG: Scope constructor 1 (UInteger) [%p]\n", (void*)this);
 #endif
-	robinHoodTable = new RobinHoodHash<RefVariableStorage>(pTableSize);
+	robinHoodTable = new RobinHoodHash<RefVariableStorage, Symbol>(pTableSize);
 }
 
 Scope::Scope( Scope&  scope )
 	: robinHoodTable(REAL_NULL)
+	, stamp(nextScopeStamp())
 {
 #ifdef COPPER_SCOPE_LEVEL_MESSAGES
 	std::printf("[DEBUG: Scope copy constructor (Scope&) [%p]\n", (void*)this);
 #endif
 	// Maintain connection
-	robinHoodTable = new RobinHoodHash<RefVariableStorage>(*(scope.robinHoodTable));
+	robinHoodTable = new RobinHoodHash<RefVariableStorage, Symbol>(*(scope.robinHoodTable));
 }
 
 Scope::~Scope() {
@@ -1364,9 +2094,9 @@ Scope& Scope::operator = (Scope& pOther) {
 	return *this;
 }
 
-bool Scope::variableExists(const String& pName) {
+bool Scope::variableExists(const Symbol& pName) {
 #ifdef COPPER_SCOPE_LEVEL_MESSAGES
-	std::printf("[DEBUG: Scope::variableExists , name=%s\n", pName.c_str());
+	std::printf("[DEBUG: Scope::variableExists , name=%s\n", pName.getName().c_str());
 #endif
 	// TODO? Streamline?
 	// For now...
@@ -1374,28 +2104,35 @@ bool Scope::variableExists(const String& pName) {
 	return findVariable(pName, v);
 }
 
+bool Scope::variableExists(const String& pName) {
+	Variable* v;
+	return findVariable(pName, v);
+}
+
 // Adds an empty variable and returns a pointer to it
-Variable* Scope::addVariable(const String& pName) {
+Variable* Scope::addVariable(const Symbol& pName) {
 #ifdef COPPER_SCOPE_LEVEL_MESSAGES
-	std::printf("[DEBUG: Scope::addVariable , name=%s\n", pName.c_str());
+	std::printf("[DEBUG: Scope::addVariable , name=%s\n", pName.getName().c_str());
 #endif
 	CHECK_SCOPE_HASH_NULL(robinHoodTable)
 
 	// Unfortunately, we can't use a local variable for the RefVariableStorage because it dies.
+	stamp = nextScopeStamp();
 	return &( robinHoodTable->insert(pName)->getVariable() );
 }
 
 // Gets the variable, creating it if it does not exist
-void Scope::getVariable(const String& pName, Variable*& pVariable) {
+void Scope::getVariable(const Symbol& pName, Variable*& pVariable) {
 #ifdef COPPER_SCOPE_LEVEL_MESSAGES
-	std::printf("[DEBUG: Scope::getVariable , name=%s\n", pName.c_str());
+	std::printf("[DEBUG: Scope::getVariable , name=%s\n", pName.getName().c_str());
 #endif
 	CHECK_SCOPE_HASH_NULL(robinHoodTable)
 
-	RobinHoodHash<RefVariableStorage>::BucketData* data = robinHoodTable->getBucketData(pName);
+	RobinHoodHash<RefVariableStorage, Symbol>::BucketData* data = robinHoodTable->getBucketData(pName);
 	if ( !data ) {
 		// Create the slot
 		// Unfortunately, we can't use a local variable for the RefVariableStorage because it dies.
+		stamp = nextScopeStamp();
 		pVariable = &( robinHoodTable->insert(pName)->getVariable() );
 	} else {
 		pVariable = &( data->item.getVariable() );
@@ -1405,13 +2142,13 @@ void Scope::getVariable(const String& pName, Variable*& pVariable) {
 // Looks for the variable. If the function exists, it saves it to storage.
 // Returns "true" if the variable was found, false otherwise.
 // Shouldn't the string here be const?
-bool Scope::findVariable(const String& pName, Variable*& pStorage) {
+bool Scope::findVariable(const Symbol& pName, Variable*& pStorage) {
 #ifdef COPPER_SCOPE_LEVEL_MESSAGES
-	std::printf("[DEBUG: Scope::findVariable , name=%s\n", pName.c_str());
+	std::printf("[DEBUG: Scope::findVariable , name=%s\n", pName.getName().c_str());
 #endif
 	CHECK_SCOPE_HASH_NULL(robinHoodTable)
 
-	RobinHoodHash<RefVariableStorage>::BucketData* bucketData;
+	RobinHoodHash<RefVariableStorage, Symbol>::BucketData* bucketData;
 
 	bucketData = robinHoodTable->getBucketData(pName);
 	if ( bucketData != 0 ) { // Hash table uses 0 instead of null
@@ -1422,48 +2159,35 @@ bool Scope::findVariable(const String& pName, Variable*& pStorage) {
 	return false;
 }
 
+bool Scope::findVariable(const String& pName, Variable*& pStorage) {
+	Symbol symbol;
+	if ( Symbol::find(pName, symbol) )
+		return findVariable(symbol, pStorage);
+	pStorage = REAL_NULL;
+	return false;
+}
+
 // Sets the variable, creating the variable if it does not exist
 // The pMakePointer option may be ignored if the FunctionObject is not owned
-void Scope::setVariable(const String& pName, Variable* pSourceVariable, bool pReuseStorage) {
+void Scope::setVariable(const Symbol& pName, Variable* pSourceVariable, bool pReuseStorage) {
 #ifdef COPPER_SCOPE_LEVEL_MESSAGES
-	std::printf("[DEBUG: Scope::setVariable , name=%s\n", pName.c_str());
+	std::printf("[DEBUG: Scope::setVariable , name=%s\n", pName.getName().c_str());
 #endif
 	// Obtain variable...
 	Variable* var;
 	getVariable(pName, var);
-
-	if ( notNull(pSourceVariable) ) {
-		var->set(pSourceVariable, pReuseStorage);
-	} else {
-		// Default
-		var->reset();
-	}
+	setVariableToVariable(var, pSourceVariable, pReuseStorage);
 }
 
 // Sets the variable, creating the variable if it does not exist
-void Scope::setVariableFrom(const String& pName, Object* pObject, bool pReuseStorage) {
+void Scope::setVariableFrom(const Symbol& pName, Object* pObject, bool pReuseStorage) {
 #ifdef COPPER_SCOPE_LEVEL_MESSAGES
-	std::printf("[DEBUG: Scope::setVariableFrom , name=%s\n", pName.c_str());
+	std::printf("[DEBUG: Scope::setVariableFrom , name=%s\n", pName.getName().c_str());
 #endif
 	// Obtain variable
 	Variable* var;
 	getVariable(pName, var);
-
-	if ( notNull(pObject) ) {
-		switch(pObject->getType()) {
-		case ObjectType::Function:
-			// Save directly
-			var->setFunc( (FunctionObject*)pObject, pReuseStorage );
-			break;
-		//case ObjectType::Data:
-		default:
-			// Save as the return of a function
-			var->setFuncReturn(pObject);
-			break;
-		}
-	} else {
-		var->reset();
-	}
+	setVariableToObject(var, pObject, pReuseStorage);
 }
 
 void Scope::appendNamesByInterface(AppendObjectInterface* aoi) {
@@ -1473,14 +2197,14 @@ void Scope::appendNamesByInterface(AppendObjectInterface* aoi) {
 	CHECK_SCOPE_HASH_NULL(robinHoodTable)
 	// This implementation is slow due to the need to copy strings.
 	// Saving string addresses is possible but not safe.
-	RobinHoodHash<RefVariableStorage>::Bucket* bucket;
+	RobinHoodHash<RefVariableStorage, Symbol>::BucketData* bucketData;
 	Object* obj;
 	uint i=0;
 	if ( notNull(robinHoodTable) ) {
 		for(; i < robinHoodTable->getSize(); ++i) {
-			bucket = robinHoodTable->get(i);
-			if ( bucket->data != 0 ) {
-				obj = new StringObject(bucket->data->name);
+			bucketData = robinHoodTable->get(i);
+			if ( bucketData != 0 ) {
+				obj = new StringObject(bucketData->name.getName());
 				aoi->append(obj);
 				obj->deref();
 			}
@@ -1496,6 +2220,7 @@ void Scope::copyMembersFrom(Scope& pOther) {
 	Scope newScope;
 	newScope = pOther;
 	robinHoodTable->appendCopyOf(*(newScope.robinHoodTable));
+	stamp = nextScopeStamp();
 }
 
 UInteger Scope::occupancy() {
@@ -1509,58 +2234,183 @@ UInteger Scope::occupancy() {
 
 //--------------------------------------
 
-StackFrame::StackFrame( VarAddress* pAddress )
-	: parent(REAL_NULL)
-	, scope(new Scope(CU_STACK_FRAME_SCOPE_SIZE))
-	, address(pAddress)
-{
-	if ( address )
-		address->ref();
+FrameLayout::FrameLayout()
+	: names(REAL_NULL)
+	, count(0)
+	, capacity(0)
+{}
+
+FrameLayout::~FrameLayout() {
+	delete[] names;
+}
+
+UInteger
+FrameLayout::add( const Symbol&  pName ) {
+	UInteger  slot = find(pName);
+	if ( slot != NoSlot )
+		return slot;
+	if ( count == capacity ) {
+		capacity = ( capacity == 0 ? 8 : capacity * 2 );
+		Symbol* newNames = new Symbol[capacity];
+		for ( slot = 0; slot < count; ++slot )
+			newNames[slot] = names[slot];
+		delete[] names;
+		names = newNames;
+	}
+	names[count] = pName;
+	return count++;
+}
+
+UInteger
+FrameLayout::find( const Symbol&  pName ) const {
+	UInteger  slot = 0;
+	for (; slot < count; ++slot) {
+		if ( names[slot].equals(pName) )
+			return slot;
+	}
+	return NoSlot;
 }
 
-StackFrame::StackFrame( const StackFrame& pOther )
+//--------------------------------------
+
+StackFrame::StackFrame( VarAddress* pAddress, FrameLayout* pLayout, Variable** pSlotStorage )
 	: parent(REAL_NULL)
+	, region(0)
 	, scope(REAL_NULL)
-	, address(REAL_NULL)
+	, address(pAddress)
+	, layout(pLayout)
+	, slots(REAL_NULL)
+	, slotCount(0)
 {
-	// Copy, don't share
-	*scope = *(pOther.scope);
-	address = pOther.address;
 	if ( address )
 		address->ref();
+	if ( layout ) {
+		layout->ref();
+		slotCount = layout->size();
+		slots = pSlotStorage;
+		UInteger  i = 0;
+		for (; i < slotCount; ++i)
+			slots[i] = REAL_NULL; // Created when first used
+	}
 }
 
 StackFrame::~StackFrame() {
-	scope->deref();
+	if ( scope )
+		scope->deref();
 	if ( address )
 		address->deref();
+	if ( layout ) {
+		UInteger  i = 0;
+		for (; i < slotCount; ++i) {
+			if ( slots[i] )
+				slots[i]->deref();
+		}
+		// Slot storage belongs to the Stack
+		layout->deref();
+	}
 }
 
 void
 StackFrame::replaceScope() {
-	scope->deref();
+	if ( scope )
+		scope->deref();
 	scope = new Scope();
 }
 
 Scope&
 StackFrame::getScope() {
+	if ( isNull(scope) )
+		scope = new Scope(CU_STACK_FRAME_SCOPE_SIZE);
 	return *scope;
 }
 
+bool
+StackFrame::findVariable( const Symbol&  pName, Variable*&  pStorage ) {
+	if ( layout ) {
+		const UInteger  slot = layout->find(pName);
+		if ( slot != FrameLayout::NoSlot ) {
+			pStorage = slots[slot];
+			return notNull(pStorage);
+		}
+	}
+	if ( isNull(scope) ) {
+		pStorage = REAL_NULL;
+		return false;
+	}
+	return scope->findVariable(pName, pStorage);
+}
+
+bool
+StackFrame::findVariable( const VarAddress&  pAddress, Variable*&  pStorage ) {
+	if ( pAddress.localSlot < slotCount ) {
+		pStorage = slots[pAddress.localSlot];
+		return notNull(pStorage);
+	}
+	return findVariable(pAddress.first(), pStorage);
+}
+
+void
+StackFrame::getVariable( const Symbol&  pName, Variable*&  pVariable ) {
+	if ( layout ) {
+		const UInteger  slot = layout->find(pName);
+		if ( slot != FrameLayout::NoSlot ) {
+			if ( isNull(slots[slot]) )
+				slots[slot] = new Variable();
+			pVariable = slots[slot];
+			return;
+		}
+	}
+	getScope().getVariable(pName, pVariable);
+}
+
+void
+StackFrame::getVariable( const VarAddress&  pAddress, Variable*&  pVariable ) {
+	if ( pAddress.localSlot < slotCount ) {
+		if ( isNull(slots[pAddress.localSlot]) )
+			slots[pAddress.localSlot] = new Variable();
+		pVariable = slots[pAddress.localSlot];
+		return;
+	}
+	getVariable(pAddress.first(), pVariable);
+}
+
+void
+StackFrame::addVariable( const Symbol&  pName ) {
+	Variable* var;
+	getVariable(pName, var);
+}
+
+void
+StackFrame::setVariable( const Symbol&  pName, Variable*  pSourceVariable, bool  pReuseStorage ) {
+	Variable* var;
+	getVariable(pName, var);
+	setVariableToVariable(var, pSourceVariable, pReuseStorage);
+}
+
+void
+StackFrame::setVariableFrom( const Symbol&  pName, Object*  pObject, bool  pReuseStorage ) {
+	Variable* var;
+	getVariable(pName, var);
+	setVariableToObject(var, pObject, pReuseStorage);
+}
+
 VarAddress*
 StackFrame::getAddress() {
 	return address;
 }
 
 Stack::Stack()
-	: size(1)
+	: regions(REAL_NULL)
+	, regionCount(0)
+	, currRegion(0)
+	, nextFree(REAL_NULL)
+	, size(0)
 	, bottom(REAL_NULL)
 	, top(REAL_NULL)
 	, globalName(new VarAddress())
 {
-	globalName->push_back("[global scope]");
-	bottom = new StackFrame(globalName);
-	top = bottom;
+	globalName->push_back(Symbol("[global scope]"));
+	push(globalName);
 }
 /*
 Stack::Stack(const Stack& pOther)
@@ -1574,27 +2424,78 @@ Stack::Stack(const Stack& pOther)
 Stack::~Stack() {
 	clear();
 	globalName->deref();
+	UInteger  r = 0;
+	for (; r < regionCount; ++r)
+		delete[] regions[r].start;
+	delete[] regions;
+}
+
+StackFrame*
+Stack::createFrame( VarAddress* pAddress, FrameLayout* pLayout ) {
+	// The slots follow the frame. Frames start on a boundary suitable for any of their members.
+	const uint  slotCount = notNull(pLayout) ? (uint)pLayout->size() : 0;
+	const uint  align = (uint)sizeof(double) > (uint)sizeof(void*) ? (uint)sizeof(double) : (uint)sizeof(void*);
+	const uint  bytes = ( (uint)(sizeof(StackFrame) + sizeof(Variable*) * slotCount) + align - 1 ) / align * align;
+
+	if ( regionCount == 0 || (uint)(regions[currRegion].end - nextFree) < bytes )
+		moveToNextRegion(bytes);
+
+	StackFrame* frame = new ((void*)nextFree) StackFrame(pAddress, pLayout, (Variable**)(nextFree + sizeof(StackFrame)));
+	frame->region = currRegion;
+	nextFree += bytes;
+	return frame;
+}
+
+void
+Stack::moveToNextRegion( uint pBytes ) {
+	const UInteger  next = ( regionCount == 0 ) ? 0 : currRegion + 1;
+	const uint  regionSize = pBytes > CU_STACK_REGION_SIZE ? pBytes : CU_STACK_REGION_SIZE;
+
+	if ( next == regionCount ) {
+		Region* newRegions = new Region[regionCount + 1];
+		UInteger  r = 0;
+		for (; r < regionCount; ++r)
+			newRegions[r] = regions[r];
+		delete[] regions;
+		regions = newRegions;
+		regions[next].start = new char[regionSize];
+		regions[next].end = regions[next].start + regionSize;
+		++regionCount;
+
+	} else if ( (uint)(regions[next].end - regions[next].start) < pBytes ) {
+		// Regions after the current one are unused, so this one can be replaced.
+		delete[] regions[next].start;
+		regions[next].start = new char[regionSize];
+		regions[next].end = regions[next].start + regionSize;
+	}
+	currRegion = next;
+	nextFree = regions[next].start;
+}
+
+void
+Stack::destroyTop() {
+	StackFrame* frame = top;
+	top = frame->parent;
+	if ( frame == bottom )
+		bottom = REAL_NULL;
+	// Frames are released in the reverse order of their creation, so the frame's memory is the end of the used memory.
+	currRegion = frame->region;
+	nextFree = (char*)frame;
+	frame->~StackFrame();
+	--size;
 }
 
 void
 Stack::clear() {
-	StackFrame* parent;
 	while( notNull(top) ) {
-		parent = top->parent;
-		top->deref();
-		top = parent;
-		--size;
+		destroyTop();
 	}
 }
 
 void
 Stack::clearNonGlobal() {
-	StackFrame* parent;
 	while ( top != bottom ) {
-		parent = top->parent;
-		top->deref();
-		top = parent;
-		--size;
+		destroyTop();
 	}
 }
 
@@ -1627,54 +2528,26 @@ StackPopReturn
 Stack::pop() {
 	if ( size == 0 )
 		return STACK_POP_done;
-	StackFrame* parent; // initialized below
-	if ( top == bottom ) {
-		top->deref();
-		bottom = REAL_NULL;
-		top = REAL_NULL;
-	} else {
-		parent = top->parent;
-		top->deref();
-		top = parent;
-	}
-	if ( size > 0 ) {
-		--size;
-	}
+	destroyTop();
 	if ( size == 0 )
 		return STACK_POP_done;
 	// else
 	return STACK_POP_more;
 }
 
-void
-Stack::push( VarAddress*  pAddress ) {
-	if ( isNull(bottom) ) {
-		bottom = new StackFrame(globalName);
-		top = bottom;
-		++size;
-		return;
-	}
-	StackFrame* parent = top;
-	top = new StackFrame(pAddress);
-	top->parent = parent;
-	++size;
-}
-
-void
-Stack::push( StackFrame*  pContext ) {
-	if ( pContext == 0 )
-		throw UninitializedStackContextException();
-	pContext->ref();
+StackFrame&
+Stack::push( VarAddress*  pAddress, FrameLayout*  pLayout ) {
 	if ( isNull(bottom) ) {
-		bottom = pContext;
+		bottom = createFrame(globalName, REAL_NULL);
 		top = bottom;
 		++size;
-		return;
+		return *bottom;
 	}
-	StackFrame* parent = top;
-	top = pContext;
-	top->parent = parent;
+	StackFrame* frame = createFrame(pAddress, pLayout);
+	frame->parent = top;
+	top = frame;
 	++size;
+	return *frame;
 }
 
 void
@@ -1697,12 +2570,85 @@ Stack::print( Logger*  pLogger ) {
 	}
 }
 
+// ************ TOKEN QUEUE **********
+
+TokenQueue::TokenQueue()
+	: tokens(REAL_NULL)
+	, capacity(0)
+	, first(0)
+	, end(0)
+	, removed(0)
+{}
+
+TokenQueue::~TokenQueue() {
+	delete[] tokens;
+}
+
+void
+TokenQueue::push_back( const Token& pToken ) {
+	uint i;
+	if ( end == capacity ) {
+		if ( first > 0 && first >= capacity / 2 ) {
+			// Reuse the slots of removed tokens
+			for ( i = first; i < end; ++i ) {
+				tokens[i - first] = tokens[i];
+				tokens[i] = Token();
+			}
+		} else {
+			const uint newCapacity = ( capacity == 0 ) ? 16 : capacity * 2;
+			Token* newTokens = new Token[newCapacity];
+			for ( i = first; i < end; ++i ) {
+				newTokens[i - first] = tokens[i];
+			}
+			delete[] tokens;
+			tokens = newTokens;
+			capacity = newCapacity;
+		}
+		removed += first;
+		end -= first;
+		first = 0;
+	}
+	tokens[end] = pToken;
+	++end;
+}
+
+void
+TokenQueue::pop() {
+	if ( end > first ) {
+		--end;
+		tokens[end] = Token();
+	}
+}
+
+void
+TokenQueue::clear() {
+	for (; first < end; ++first ) {
+		tokens[first] = Token();
+	}
+	removed += end;
+	first = 0;
+	end = 0;
+}
+
+void
+TokenQueue::removeUpTo( const Iter& pStop ) {
+	if ( pStop.queue != this )
+		throw util::BadIteratorException();
+
+	uint stop = pStop.position - removed;
+	if ( stop > end )
+		stop = end;
+	for (; first < stop; ++first ) {
+		tokens[first] = Token();
+	}
+}
+
 // ************ PARSE TASKS **********
 
 ParserContext::ParserContext()
 	: tokenSource(REAL_NULL)
-	, currToken(REAL_NULL)
-	, lastUsedToken(REAL_NULL)
+	, currToken()
+	, lastUsedToken()
 	, outputStrand(new OpStrand())
 	, taskStack()
 {
@@ -1712,12 +2658,6 @@ ParserContext::ParserContext()
 }
 
 ParserContext::~ParserContext() {
-	if ( notNull(currToken) ) {
-		delete currToken;
-	}
-	if ( notNull(lastUsedToken) ) {
-		delete lastUsedToken;
-	}
 	outputStrand->deref();
 }
 
@@ -1732,15 +2672,11 @@ ParserContext::setTokenSource(
 	if ( tokenSource == &source )
 		return;
 	tokenSource = &source;
-	if ( notNull(currToken) ) {
-		delete currToken;
-	}
-	if ( notNull(lastUsedToken) ) {
-		delete lastUsedToken;
-	}
-	lastUsedToken = REAL_NULL;
+	lastUsedToken = TokenQueueIter();
 	if ( source.has() )
-		currToken = new TokenQueueIter(source);
+		currToken = TokenQueueIter(source);
+	else
+		currToken = TokenQueueIter();
 }
 
 void
@@ -1756,8 +2692,8 @@ ParserContext::setCodeStrand( OpStrand* strand ) {
 
 bool
 ParserContext::isFinished() {
-	if ( notNull(lastUsedToken) ) {
-		return lastUsedToken->atEnd();
+	if ( lastUsedToken.isSet() ) {
+		return lastUsedToken.atEnd();
 	}
 	return (isNull(tokenSource)) ? true : (! tokenSource->has());
 }
@@ -1768,9 +2704,8 @@ ParserContext::onError() {
 	std::printf("[DEBUG: ParserContext::onError\n");
 #endif
 	// Current activity: "Chew up" the bad tokens.
-	if ( notNull(lastUsedToken) ) {
-		delete lastUsedToken;
-		lastUsedToken = new TokenQueueIter(*currToken);
+	if ( lastUsedToken.isSet() ) {
+		lastUsedToken = currToken;
 	}
 	// I may experiment with different actions here.
 }
@@ -1778,20 +2713,17 @@ ParserContext::onError() {
 // Returns "true" if the move could be made
 bool
 ParserContext::moveToFirstUnusedToken() {
-	if ( notNull(lastUsedToken) ) {
-		if ( notNull(currToken) ) {
-			delete currToken;
-		}
-		currToken = new TokenQueueIter(*lastUsedToken);
+	if ( lastUsedToken.isSet() ) {
+		currToken = lastUsedToken;
 #ifdef COPPER_DEBUG_ENGINE_MESSAGES
-		if ( currToken->next() ) {
+		if ( currToken.next() ) {
 			std::printf("[DEBUG: ParserContext::moveToFirstUnusedToken fulfilled\n");
 			return true;
 		} else {
 			return false;
 		}
 #else
-		return currToken->next();
+		return currToken.next();
 #endif
 	}
 	// Start from the beginning
@@ -1799,52 +2731,49 @@ ParserContext::moveToFirstUnusedToken() {
 		throw ParserContextEmptySourceException();
 
 	// Apparently, none have been used yet
-	if ( isNull( currToken ) ) {
-		currToken = new TokenQueueIter(*tokenSource);
+	if ( ! currToken.isSet() ) {
+		currToken = TokenQueueIter(*tokenSource);
 	} else {
-		currToken->reset();
+		currToken.reset();
 	}
-	return currToken->has();
+	return currToken.has();
 }
 
-Token
+const Token&
 ParserContext::peekAtToken() {
-	if ( isNull(currToken) || ! currToken->has() )
+	if ( ! currToken.isSet() || ! currToken.has() )
 		throw ParserContextEmptySourceException();
-	return **currToken;
+	return *currToken;
 }
 
 bool
 ParserContext::moveToNextToken() {
-	if ( isNull(currToken) )
+	if ( ! currToken.isSet() )
 		throw ParserContextEmptySourceException();
-	if ( ! currToken->has() )
+	if ( ! currToken.has() )
 		return false;
-	return currToken->next();
+	return currToken.next();
 }
 
 bool
 ParserContext::moveToPreviousToken() {
-	if ( isNull(currToken) )
+	if ( ! currToken.isSet() )
 		throw ParserContextEmptySourceException();
-	if ( ! currToken->has() )
+	if ( ! currToken.has() )
 		return false;
-	return currToken->prev();
+	return currToken.prev();
 }
 
 void
 ParserContext::commitTokenUsage() {
-	if ( notNull(lastUsedToken) ) {
-		delete lastUsedToken;
-		lastUsedToken = REAL_NULL;
-	}
-	// Should this be if(notNull(currToken)) ?
+	lastUsedToken = TokenQueueIter();
+	// Should this be if(currToken.isSet()) ?
 	// Seems like it would mess up for clearUsedTokens().
-	if ( currToken->has() ) {
+	if ( currToken.has() ) {
 #ifdef COPPER_PARSER_LEVEL_MESSAGES
 		std::printf("[DEBUG: ParserContext::commitTokenUsage fulfilled\n");
 #endif
-		lastUsedToken = new TokenQueueIter(*currToken);
+		lastUsedToken = currToken;
 	}
 }
 
@@ -1853,16 +2782,16 @@ ParserContext::clearUsedTokens() {
 #ifdef COPPER_PARSER_LEVEL_MESSAGES
 	std::printf("[DEBUG: ParserContext::clearUsedTokens\n");
 #endif
-	if ( notNull(lastUsedToken) ) {
+	if ( lastUsedToken.isSet() ) {
 		if ( notNull(tokenSource) ) {
-			tokenSource->removeUpTo(*lastUsedToken);
+			tokenSource->removeUpTo(lastUsedToken);
 			// Note: The lastUsedToken is NOT removed so that complicated re-init
 			// for the context is not needed
 		}
 	}
 }
 
-void
+uint
 ParserContext::addNewOperation( Opcode* newOp ) {
 #ifdef COPPER_PARSER_LEVEL_MESSAGES
 	std::printf("[DEBUG: ParserContext::addNewOperation, type = %u\n", (newOp? newOp->getType() : 0));
@@ -1871,11 +2800,12 @@ ParserContext::addNewOperation( Opcode* newOp ) {
 		throw EmptyOpstrandException();
 	if ( isNull(newOp) )
 		throw NullOpcodeException();
-	outputStrand->push_back(OpcodeContainer(newOp));
+	const uint index = outputStrand->push_back(newOp);
 	newOp->deref();
+	return index;
 }
 
-void
+uint
 ParserContext::addOperation( Opcode* op ) {
 #ifdef COPPER_PARSER_LEVEL_MESSAGES
 	std::printf("[DEBUG: ParserContext::addOperation, type = %u\n", (op? op->getType() : 0));
@@ -1884,7 +2814,7 @@ ParserContext::addOperation( Opcode* op ) {
 		throw EmptyOpstrandException();
 	if ( isNull(op) )
 		throw NullOpcodeException();
-	outputStrand->push_back(OpcodeContainer(op));
+	return outputStrand->push_back(op);
 }
 
 void
@@ -1940,13 +2870,31 @@ FuncFoundTask::FuncFoundTask(
 }
 
 FuncFoundTask::~FuncFoundTask() {
-	ArgsIter ai = args.start();
+	release();
+}
+
+void
+FuncFoundTask::release() {
+	ArgsBuffer::Iter ai = args.start();
 	if ( ai.has() )
 	do {
 		(*ai)->deref();
 	} while ( ai.next() );
-	// args.clear(); // implicit
-	varAddress->deref();
+	args.clear(); // Keeps any spilled storage for the next call
+	if ( notNull(varAddress) ) {
+		varAddress->deref();
+		varAddress = REAL_NULL;
+	}
+}
+
+void
+FuncFoundTask::setAddress(
+	VarAddress* pVarAddress
+) {
+	pVarAddress->ref();
+	if ( notNull(varAddress) )
+		varAddress->deref();
+	varAddress = pVarAddress;
 }
 
 void
@@ -1960,13 +2908,11 @@ FuncFoundTask::addArg(
 }
 
 
-IfStructureParseTask::IfStructureParseTask(
-	OpStrand* strand
-)
+IfStructureParseTask::IfStructureParseTask()
 	: ParseTask(ParseTask::If)
-	, firstIter(*strand)
 	, openBodies(1) // The first parameter body token is always skipped, so it is counted here
-	, conditionalGoto(REAL_NULL)
+	, conditionalGoto(0)
+	, hasConditionalGoto(false)
 	, finalGotos()
 	, atElse(false)
 	, state(Start)
@@ -1974,26 +2920,25 @@ IfStructureParseTask::IfStructureParseTask(
 #ifdef COPPER_PARSER_LEVEL_MESSAGES
 	std::printf("[DEBUG: IfStructureParseTask constructor\n");
 #endif
-	// This task is created AFTER the terminal opcode has been added, which is the last opcode
-	firstIter.makeLast();
 }
 
 // Queues a conditional goto meant to be set to the next terminal when added
 void
 IfStructureParseTask::queueNewConditionalJump(
-	Opcode* jump
+	uint jump
 ) {
 #ifdef COPPER_PARSER_LEVEL_MESSAGES
 	std::printf("[DEBUG: IfStructureParseTask::queueNewConditionalJump\n");
 #endif
 	// Fortunately, only one of these ever shows up at a time
 	conditionalGoto = jump;
+	hasConditionalGoto = true;
 }
 
 // Queues a new goto meant to be set to the last terminal when added
 void
 IfStructureParseTask::queueNewFinalJumpCode(
-	Opcode* jump
+	uint jump
 ) {
 #ifdef COPPER_PARSER_LEVEL_MESSAGES
 	std::printf("[DEBUG: IfStructureParseTask::queueNewFinalJumpCode\n");
@@ -2008,10 +2953,10 @@ IfStructureParseTask::finalizeConditionalGoto(
 #ifdef COPPER_PARSER_LEVEL_MESSAGES
 	std::printf("[DEBUG: IfStructureParseTask::finalizeConditionalGoto\n");
 #endif
-	context.addNewOperation( new Opcode(Opcode::Terminal) );
-	if ( notNull( conditionalGoto ) ) {
-		conditionalGoto->setTarget( context.outputStrand->end() );
-		conditionalGoto = REAL_NULL;
+	const uint terminal = context.addNewOperation( new Opcode(Opcode::Terminal) );
+	if ( hasConditionalGoto ) {
+		context.outputStrand->setJump( conditionalGoto, terminal );
+		hasConditionalGoto = false;
 	} else {
 		throw NullIfStructureConditionException();
 	}
@@ -2024,12 +2969,11 @@ IfStructureParseTask::finalizeGotos(
 #ifdef COPPER_PARSER_LEVEL_MESSAGES
 	std::printf("[DEBUG: IfStructureParseTask::finalizeGotos\n");
 #endif
-	context.addNewOperation( new Opcode(Opcode::Terminal) );
-	OpStrandIter lastIter = context.outputStrand->end();
-	List<Opcode*>::Iter fg = finalGotos.start();
+	const uint terminal = context.addNewOperation( new Opcode(Opcode::Terminal) );
+	List<uint>::Iter fg = finalGotos.start();
 	if ( fg.has() )
 	do {
-		(*fg)->setTarget( lastIter );
+		context.outputStrand->setJump( *fg, terminal );
 	} while ( fg.next() );
 	finalGotos.clear();
 }
@@ -2038,7 +2982,8 @@ LoopStructureParseTask::LoopStructureParseTask(
 	OpStrand* strand
 )
 	: ParseTask( ParseTask::Loop )
-	, firstIter(*strand)
+	// This task is created AFTER the terminal opcode has been added, which is the last opcode
+	, firstIndex(strand->size() - 1)
 	, finalGotos()
 	, openBodies(1)
 	, state(Start)
@@ -2046,23 +2991,22 @@ LoopStructureParseTask::LoopStructureParseTask(
 #ifdef COPPER_PARSER_LEVEL_MESSAGES
 	std::printf("[DEBUG: LoopStructureParseTask constructor\n");
 #endif
-	// This task is created AFTER the terminal opcode has been added, which is the last opcode
-	firstIter.makeLast();
 }
 
 void
 LoopStructureParseTask::setGotoOpcodeToLoopStart(
-	Opcode* code
+	OpStrand* strand,
+	uint code
 ) {
 #ifdef COPPER_PARSER_LEVEL_MESSAGES
 	std::printf("[DEBUG: LoopStructureParseTask::setGotoOpcodeToLoopStart\n");
 #endif
-	code->setTarget( firstIter );
+	strand->setJump( code, firstIndex );
 }
 
 void
 LoopStructureParseTask::queueFinalGoto(
-	Opcode* code
+	uint code
 ) {
 #ifdef COPPER_PARSER_LEVEL_MESSAGES
 	std::printf("[DEBUG: LoopStructureParseTask::queueFinalGoto\n");
@@ -2077,11 +3021,11 @@ LoopStructureParseTask::finalizeGotos(
 #ifdef COPPER_PARSER_LEVEL_MESSAGES
 	std::printf("[DEBUG: LoopStructureParseTask::finalizeGotos\n");
 #endif
-	OpStrandIter lastIter = strand->end();
-	List<Opcode*>::Iter fg = finalGotos.start();
+	const uint lastIndex = strand->size() - 1;
+	List<uint>::Iter fg = finalGotos.start();
 	if ( fg.has() )
 	do {
-		(*fg)->setTarget( lastIter );
+		strand->setJump( *fg, lastIndex );
 	} while ( fg.next() );
 	finalGotos.clear();
 }
@@ -2090,7 +3034,7 @@ LoopStructureParseTask::finalizeGotos(
 
 FFIServices::FFIServices(
 	Engine&			enginePtr,
-	ArgsList&		args,
+	ArgsBuffer&		args,
 	String			foreignFuncName
 )
 	: engine(enginePtr)
@@ -2099,13 +3043,11 @@ FFIServices::FFIServices(
 	, who()
 {
 	who.steal(foreignFuncName); // Cheat the copy
-	ArgsIter  argsIter = args.start();
 	numArgs = args.size();
 	argsArray = new RefPtr<Object>[numArgs];
 	UInteger i = 0;
 	for(; i < numArgs; ++i) {
-		argsArray[i].set( *argsIter );
-		argsIter.next();
+		argsArray[i].set( args.get(i) );
 	}
 }
 
@@ -2309,7 +3251,7 @@ createAddress(
 	do {
 		if ( *asCLIter == '.' ) {
 			if ( part.has() ) {
-				finalAddress.push_back(part);
+				finalAddress.push_back( Symbol(String(part)) );
 				part.clear();
 			}
 		} else {
@@ -2317,7 +3259,7 @@ createAddress(
 		}
 	} while ( asCLIter.next() );
 	if ( part.size() > 0 )
-		finalAddress.push_back(part);
+		finalAddress.push_back( Symbol(String(part)) );
 	return finalAddress;
 }
 
@@ -2334,7 +3276,7 @@ addressToString(
 	CharList builder;
 	VarAddress::Iterator i = address.iterator();
 	while( ! i.atEnd() ) {
-		builder.append( i.get() );
+		builder.append( i.get().getName() );
 		if ( ! i.atLast() ) { // If not at the last part
 			builder.push_back('.');
 		}
@@ -2343,23 +3285,52 @@ addressToString(
 	return String(builder);
 }
 
+const Symbol&
+VarAddress::getFullName() const {
+	// Addresses are constant after being built, so the name is only found once.
+	// Dotted names are not interned: they only name foreign functions, which are interned when added.
+	// A name not yet interned is looked up again next time, in case such a function has been added.
+	if ( ! hasFullName ) {
+		if ( hasOne() ) {
+			fullName = head->data;
+			hasFullName = true;
+		} else {
+			hasFullName = Symbol::find( addressToString(*this), fullName );
+		}
+	}
+	return fullName;
+}
+
 
 //--------------------------------------
 
+// Stamps are shared by all engines so that an address cached by one is never valid for another.
+static UInteger nextForeignFunctionsStamp() {
+	static UInteger lastStamp = 0;
+	return ++lastStamp;
+}
+
 Engine::Engine()
-	: logger(REAL_NULL)
+	: symbolTableOwner()
+	, logger(REAL_NULL)
 	, stack()
 	, taskStack()
+	, spareFuncFoundTasks()
+	, sysCallArgs()
 	, lastObject()
+	, nilObject(new NilObject())
+	, trueObject(new BoolObject(true))
+	, falseObject(new BoolObject(false))
 	, bufferedTokens()
 	, globalParserContext()
 	, opcodeStrandStack()
 	, activeOpcodeStrandStack(&opcodeStrandStack)
 	, endMainCallback(REAL_NULL)
-	//, builtinFunctions(50)
-	, builtinFunctions(64)
 	//, foreignFunctions(100)
 	, foreignFunctions(128)
+	, foreignFunctionsStamp(nextForeignFunctionsStamp())
+	, memberCacheHits(0)
+	, memberCacheMisses(0)
 	, ignoreBadForeignFunctionCalls(false)
 	, ownershipChangingEnabled(false)
 	, stackTracePrintingEnabled(false)
@@ -2367,8 +3338,6 @@ Engine::Engine()
 	, nameFilter(REAL_NULL)
 	, customObjectFactory(REAL_NULL)
 {
-	setupSystemFunctions();
-
 	// Ensures global/starting OpStrandContainer gets a valid iterator
 	// Add a do-nothing "operation"
 	globalParserContext.addNewOperation( new Opcode(Opcode::Terminal) );
@@ -2379,6 +3348,14 @@ Engine::Engine()
 	);
 }
 
+Engine::~Engine() {
+	releaseSysCallArgs(0);
+	lastObject.set(REAL_NULL);
+	nilObject->deref();
+	trueObject->deref();
+	falseObject->deref();
+}
+
 void Engine::setLogger( Logger* pLogger ) {
 	logger = pLogger;
 }
@@ -2461,7 +3438,16 @@ Engine::addForeignFunction(
 #endif
 	if ( isNull(pFunction) )
 		throw NullForeignFunctionException();
-	foreignFunctions.insert(pName, ForeignFuncContainer(pFunction));
+	const Symbol name(pName);
+	RobinHoodHash<ForeignFuncContainer, Symbol>::BucketData* bucketData
+		= foreignFunctions.getBucketData(name);
+	if ( bucketData ) {
+		bucketData->item.set(pFunction);
+	} else {
+		foreignFunctions.insert(name, ForeignFuncContainer(pFunction));
+	}
+	// Invalidate the foreign functions cached in addresses
+	foreignFunctionsStamp = nextForeignFunctionsStamp();
 }
 
 EngineResult::Value
@@ -2507,12 +3493,13 @@ Engine::run(
 void
 Engine::printGlobalStrand() {
 	print(LogLevel::debug, "[DEBUG: Engine::printGlobalStrand()");
-	OpStrandIter opIter = globalParserContext.outputStrand->start();
-	if ( opIter.has() ) {
+	OpStrand* strand = globalParserContext.outputStrand;
+	uint i = 0;
+	if ( strand->size() > 0 ) {
 		print(LogLevel::debug, "[DEBUG: Global strand:");
-		do {
-			std::printf("[ Opcode = %p, value = %u\n", (void*)(opIter->getOp()), (UInteger)(opIter->getOp()->getType()) );
-		} while ( opIter.next() );
+		for (; i < strand->size(); ++i) {
+			std::printf("[ Opcode index = %lu, value = %u\n", (unsigned long)i, (UInteger)(strand->get(i).getType()) );
+		}
 	} else {
 		print(LogLevel::debug, "[DEBUG: Global strand is empty.");
 	}
@@ -2539,12 +3526,14 @@ Engine::lexAndParse(
 	print(LogLevel::debug, "[DEBUG: Engine::lexAndParse");
 #endif
 	char c;
-	CharList tokenValue; // Since I have to build with it, it's an easy-to-append-to list
+	// Tokens are collected here and interned from here, so names are never copied to the heap.
+	char tokenValue[256];
+	uint tokenLength = 0;
 	//List<Token> bufferedTokens; // Within the engine, so it's state is saved
 	TokenType tokenType;
+	ByteStreamReader reader(stream);
 
-	while ( ! stream.atEOS() ) {
-		c = stream.getNextByte();
+	while ( reader.next(c) ) {
 
 		if ( c == '\0' ) {
 			print(LogLevel::error, "Random null byte in stream");
@@ -2552,55 +3541,59 @@ Engine::lexAndParse(
 		}
 
 		if ( isWhitespace(c) ) {
-			if ( tokenValue.size() == 0 ) {
-				continue;
-			}
-			switch( tokenize(tokenValue, bufferedTokens) ) {
-			case Result::Error:
-				return ParseResult::Error;
-			default: break;
+			if ( tokenLength > 0 ) {
+				switch( tokenize(StringSpan(tokenValue, tokenLength), bufferedTokens) ) {
+				case Result::Error:
+					return ParseResult::Error;
+				default: break;
+				}
+				tokenLength = 0;
 			}
+			reader.skipWhitespace();
 		}
 		else if ( isSpecialCharacter(c, tokenType) ) {
 			// If another token was started, finish it.
-			if ( tokenValue.size() > 0 ) {
+			if ( tokenLength > 0 ) {
 				// To allow for numbers to be tokenized with decimal places.
 				if ( c == '.' && tokenValue[0] >= '0' && tokenValue[0] <= '9' ) {
 					// Should check here for already-existing decimal and throw an error if found.
-					tokenValue.push_back(c);
+					if ( tokenLength >= 255 ) {
+						print(LogLevel::error, EngineMessage::LongToken);
+						return ParseResult::Error;
+					}
+					tokenValue[tokenLength] = c;
+					++tokenLength;
 					continue;
 				} else {
-					switch( tokenize(tokenValue, bufferedTokens) ) {
+					switch( tokenize(StringSpan(tokenValue, tokenLength), bufferedTokens) ) {
 					case Result::Error:
 						return ParseResult::Error;
 					default: break;
 					}
 				}
-				tokenValue.clear();
+				tokenLength = 0;
 			}
-//#if COPPER_DEBUG_ENGINE_MESSAGES
-			tokenValue.push_back(c);
-//#endif
 			// Comments, strings, and special chars are special cases that need to be handled immediately
-			switch( handleCommentsStringsAndSpecials(tokenType, tokenValue, bufferedTokens, stream) ) {
+			switch( handleCommentsStringsAndSpecials(tokenType, c, bufferedTokens, reader) ) {
 			case Result::Error:
 				return ParseResult::Error;
 			default: break;
 			}
 		}
 		else {
-			if ( tokenValue.size() >= 255 ) { // Don't accept tokens longer than this
+			if ( tokenLength >= 255 ) { // Don't accept tokens longer than this
 				//print(LogLevel::error, "ERROR: Token identifier is too long." );
 				print(LogLevel::error, EngineMessage::LongToken);
 				return ParseResult::Error;
 			}
-			tokenValue.push_back(c);
+			tokenValue[tokenLength] = c;
+			++tokenLength;
 		}
 	}
 
-	if ( tokenValue.size() > 0 ) {
+	if ( tokenLength > 0 ) {
 		// Push the last token
-		switch( tokenize(tokenValue, bufferedTokens) ) {
+		switch( tokenize(StringSpan(tokenValue, tokenLength), bufferedTokens) ) {
 		case Result::Error:
 			return ParseResult::Error;
 		default: break;
@@ -2645,24 +3638,22 @@ void Engine::signalEndofProcessing() {
 void Engine::printTaskTrace() {
 	if ( isNull(logger) )
 		return;
-	List<TaskContainer>::Iter  ti = taskStack.start();
-	if ( ! ti.has() )
-		return;
-	UInteger  t_index = 1;
-	do {
-		if ( ti->getTask().name == TaskType::FuncBuild ) {
-			logger->printTaskTrace(TaskType::FuncBuild, "Body construction", t_index);
-		} else if ( ti->getTask().name == TaskType::FuncFound ) {
+	uint  t = 0;
+	Task*  task;
+	for (; t < taskStack.size(); ++t) {
+		task = taskStack.get(t);
+		if ( task->name == TaskType::FuncBuild ) {
+			logger->printTaskTrace(TaskType::FuncBuild, "Body construction", (UInteger)(t + 1));
+		} else if ( task->name == TaskType::FuncFound ) {
 			logger->printTaskTrace(
 				TaskType::FuncFound,
 				addressToString(
-					((FuncFoundTask&)(ti->getTask())).getAddress()
+					((FuncFoundTask*)task)->getAddress()
 				),
-				t_index
+				(UInteger)(t + 1)
 			);
 		}
-		++t_index;
-	} while ( ti.next() );
+	}
 }
 
 void Engine::printStackTrace() {
@@ -2678,6 +3669,7 @@ void Engine::clearStacks() {
 	print(LogLevel::debug, "[DEBUG: Engine::clearStacks");
 #endif
 	taskStack.clear();
+	releaseSysCallArgs(0);
 	stack.clearNonGlobal();
 	//stack.clear(); // now using clearNonGlobal
 	//globalParserContext.clear();
@@ -2688,14 +3680,18 @@ void Engine::clearStacks() {
 	//stack.push(); // now using clearNonGlobal
 }
 
-Scope&
-Engine::getGlobalScope() {
-	return stack.getBottom().getScope();
+void Engine::releaseSysCallArgs( uint  pSize ) {
+	uint i = pSize;
+	for (; i < sysCallArgs.size(); ++i) {
+		if ( notNull(sysCallArgs.get(i)) )
+			sysCallArgs.get(i)->deref();
+	}
+	sysCallArgs.truncate(pSize);
 }
 
 Scope&
-Engine::getCurrentTopScope() {
-	return stack.getTop().getScope();
+Engine::getGlobalScope() {
+	return stack.getBottom().getScope();
 }
 
 ParserContext&
@@ -2735,16 +3731,16 @@ Engine::setVariableByAddress(
 			break;
 		}
 	} else {
-		lastObject.setWithoutRef(new NilObject()); // was new FunctionObject, but that's pointless.
+		setLastObjectNil(); // was new FunctionObject, but that's pointless.
 	}
 }
 
 TokenType
-Engine::resolveTokenType( const String& pName ) {
+Engine::resolveTokenType( const StringSpan& pName, Symbol& pSymbol ) {
 #ifdef COPPER_DEBUG_ENGINE_MESSAGES
 	print(LogLevel::debug, "[DEBUG: Engine::resolveTokenType");
 #endif
-	if ( pName.size() == 0 ) {
+	if ( pName.length == 0 ) {
 		print(LogLevel::error, EngineMessage::ZeroSizeToken);
 		return TT_malformed;
 	}
@@ -2757,28 +3753,7 @@ Engine::resolveTokenType( const String& pName ) {
 	//	return tokenType;
 	//}
 
-	if ( pName.equals(CONSTANT_END_MAIN) )
-		return TT_end_main;
-	if ( pName.equals(CONSTANT_EXIT) )
-		return TT_exit;
-	if ( pName.equals(CONSTANT_TOKEN_IF) )
-		return TT_if;
-	if ( pName.equals(CONSTANT_TOKEN_ELIF) )
-		return TT_elif;
-	if ( pName.equals(CONSTANT_TOKEN_ELSE) )
-		return TT_else;
-	if ( pName.equals(CONSTANT_TOKEN_LOOP) )
-		return TT_loop;
-	if ( pName.equals(CONSTANT_TOKEN_ENDLOOP) )
-		return TT_endloop;
-	if ( pName.equals(CONSTANT_TOKEN_LOOPSKIP) )
-		return TT_skip;
-	if ( pName.equals(CONSTANT_TOKEN_TRUE) )
-		return TT_boolean_true;
-	if ( pName.equals(CONSTANT_TOKEN_FALSE) )
-		return TT_boolean_false;
-
-	if ( pName[0] >= '0' && pName[0] <= '9' ) {
+	if ( pName.start[0] >= '0' && pName.start[0] <= '9' ) {
 		switch ( pName.numberType() ) {
 		case 1:
 			return TT_num_integer;
@@ -2792,10 +3767,19 @@ Engine::resolveTokenType( const String& pName ) {
 		}
 	}
 
+	// Keywords (and the other reserved names) are already interned, so a single lookup finds them.
+	pSymbol = Symbol::fromId( SymbolTable::get().find(pName) );
+	const ReservedName*  reservedName = pSymbol.getReservedName();
+	if ( reservedName && reservedName->kind == ReservedName::Keyword )
+		return reservedName->tokenType;
+
 	// Excluding lower system characters, other characters are valid (Unicode acceptable)
 	// Lower system characters are unknown, not malformed, so check here for lower bound
-	if ( isValidNameCharacter(pName[0]) || nameFilter ) {
+	if ( isValidNameCharacter(pName.start[0]) || nameFilter ) {
 		if ( isValidName(pName) ) {
+			// Only valid names are added to the symbol table
+			if ( pSymbol.getId() == 0 )
+				pSymbol = Symbol(pName);
 			return TT_name;
 		} else {
 			print(LogLevel::error, EngineMessage::InvalidName);
@@ -2807,55 +3791,53 @@ Engine::resolveTokenType( const String& pName ) {
 }
 
 Result::Value
-Engine::tokenize( CharList& tokenValue, List<Token>& tokens ) {
+Engine::tokenize( const StringSpan& tokenValue, TokenQueue& tokens ) {
 #ifdef COPPER_DEBUG_ENGINE_MESSAGES
 	print(LogLevel::debug, "[DEBUG: Engine::tokenize");
 #endif
-	const String tokenName(tokenValue);
-	TokenType tokenType = resolveTokenType( tokenName );
+	Symbol symbol;
+	TokenType tokenType = resolveTokenType( tokenValue, symbol );
 
 	//std::printf("[DEBUG: token id =%u\n", (UInteger)tokenType);
 
-	if ( isValidToken(tokenType) ) {
-		tokens.push_back( Token(tokenType, tokenName) );
-	} else {
+	if ( ! isValidToken(tokenType) ) {
 		return Result::Error;
 	}
-	tokenValue.clear();
+	switch( tokenType ) {
+	case TT_num_integer:
+	case TT_num_decimal:
+	case TT_binary:
+	case TT_string: // Malformed numbers
+		tokens.push_back( Token(tokenType, new TokenLiteral(tokenValue)) );
+		break;
+	default:
+		tokens.push_back( Token(tokenType, symbol) );
+		break;
+	}
 	return Result::Ok;
 }
 
 Result::Value
 Engine::handleCommentsStringsAndSpecials(
 	const TokenType&	tokenType,
-	CharList&			tokenValue,
-	List<Token>&		tokens,
-	ByteStream&			stream
+	const char			c,
+	TokenQueue&			tokens,
+	ByteStreamReader&	reader
 ) {
 #ifdef COPPER_DEBUG_ENGINE_MESSAGES
 	print(LogLevel::debug, "[DEBUG: Engine::handleCommentsStringsAndSpecials");
 #endif
-	CharList collectedValue;
-
-	const String tokenName(tokenValue);
+	TokenLiteral* literal;
 
 	switch( tokenType ) {
 	// Handle comments
 	case TT_comment:
-		switch( scanComment(stream) ) {
-		case Result::Ok:
-			tokenValue.clear();
-			return Result::Ok;
-		case Result::Error:
-			return Result::Error;
-		}
-		break;
+		return scanComment(reader);
 
 	case TT_string:
-		switch( collectString(stream, collectedValue) ) {
+		switch( collectString(reader, literal) ) {
 		case Result::Ok:
-			tokens.push_back( Token(TT_string, String(collectedValue)) );
-			tokenValue.clear();
+			tokens.push_back( Token(TT_string, literal) );
 			return Result::Ok;
 		case Result::Error:
 			return Result::Error;
@@ -2865,13 +3847,11 @@ Engine::handleCommentsStringsAndSpecials(
 	case TT_escape_character:
 		//print(LogLevel::error, "ERROR: Escape-character outside of string.");
 		print(LogLevel::error, EngineMessage::EscapeCharMisplaced);
-			tokenValue.clear();
 		return Result::Error;
 
 	default:
 		if ( isValidToken(tokenType) ) {
-			tokens.push_back( Token(tokenType, String(tokenValue)) );
-			tokenValue.clear();
+			tokens.push_back( Token(tokenType, Symbol(StringSpan(&c, 1))) );
 		} else {
 			return Result::Error;
 		}
@@ -2970,16 +3950,24 @@ Engine::isValidNameCharacter( const char c ) const {
 }
 
 bool
-Engine::isValidName( const String& pName ) const {
+Engine::isValidName( const String& pName ) const {
+	if ( nameFilter ) {
+		return nameFilter(pName);
+	}
+	return isValidName( StringSpan(pName.c_str(), pName.size()) );
+}
+
+bool
+Engine::isValidName( const StringSpan& pName ) const {
 	//if ( pName.size() > 256 )
 	//	return false;
 		// For checking Unicode if desired
 	if ( nameFilter ) {
-		return nameFilter(pName);
+		return nameFilter(String(pName));
 	}
 	UInteger i=0;
-	for (; i < pName.size(); ++i ) {
-		if ( isValidNameCharacter(pName[i]) )
+	for (; i < pName.length; ++i ) {
+		if ( isValidNameCharacter(pName.start[i]) )
 			continue;
 		// TODO: I need to block invisible and undefined/nonprintable characters.
 		return false; // Otherwise, invalid character
@@ -2999,20 +3987,16 @@ Engine::isStringToken( const char c ) const {
 
 Result::Value
 Engine::scanComment(
-	ByteStream& stream
+	ByteStreamReader& reader
 ) {
 	char c = '`';
-	while ( ! stream.atEOS() ) {
-		c = stream.getNextByte();
+	// Only the escape and comment characters matter within a comment
+	while ( reader.nextOf(CONSTANT_ESCAPE_CHARACTER_TOKEN, CONSTANT_COMMENT_TOKEN, c) ) {
 		if ( isEscapeCharacter(c) ) {
-			if ( !stream.atEOS() ) {
-				c = stream.getNextByte();
-				continue;
-			}
+			if ( ! reader.next(c) )
+				break;
 		} else {
-			if ( isCommentToken(c) ) {
-				return Result::Ok;
-			}
+			return Result::Ok;
 		}
 	}
 	//print(LogLevel::error, "ERROR: Stream halted before comment ended.");
@@ -3022,36 +4006,47 @@ Engine::scanComment(
 
 Result::Value
 Engine::collectString(
-	ByteStream& stream,
-	CharList& collectedValue
+	ByteStreamReader& reader,
+	TokenLiteral*& literal
 ) {
+	// Strings without escape characters are usually within one block, so they are taken from it
+	// whole. Other strings are collected piece by piece.
+	CharList collectedValue;
+	StringSpan run(REAL_NULL, 0);
 	char c = '`';
-	while ( ! stream.atEOS() ) {
-		c = stream.getNextByte();
-		if ( isEscapeCharacter(c) ) {
-			if ( ! stream.atEOS() ) {
-				c = stream.getNextByte();
-				switch(c) {
-				case 'n':
-					collectedValue.push_back( '\n' );
-					break;
-				case 'r':
-					collectedValue.push_back( '\r' );
-					break;
-				case 't':
-					collectedValue.push_back( '\t' );
-					break;
-				default:
-					collectedValue.push_back( c );
-					break;
-				}
-			}
+	while ( reader.nextRun(CONSTANT_STRING_TOKEN, CONSTANT_ESCAPE_CHARACTER_TOKEN, run) ) {
+		if ( reader.atBlockEnd() ) {
+			collectedValue.append(run);
 			continue;
 		}
+		reader.next(c);
 		if ( isStringToken(c) ) {
+			if ( collectedValue.has() ) {
+				collectedValue.append(run);
+				literal = new TokenLiteral(collectedValue);
+			} else {
+				literal = new TokenLiteral(run);
+			}
 			return Result::Ok;
 		}
-		collectedValue.push_back(c);
+		// Escape character
+		collectedValue.append(run);
+		if ( reader.next(c) ) {
+			switch(c) {
+			case 'n':
+				collectedValue.push_back( '\n' );
+				break;
+			case 'r':
+				collectedValue.push_back( '\r' );
+				break;
+			case 't':
+				collectedValue.push_back( '\t' );
+				break;
+			default:
+				collectedValue.push_back( c );
+				break;
+			}
+		}
 	}
 	//print(LogLevel::error, "ERROR: Stream halted before string ended.");
 	print( LogLevel::error, EngineMessage::StreamHaltedInString );
@@ -3059,97 +4054,6 @@ Engine::collectString(
 }
 
 
-//--------------------------------------
-// ******** SYSTEM FUNCTION SETUP ******
-
-void
-Engine::setupSystemFunctions() {
-#ifdef COPPER_DEBUG_ENGINE_MESSAGES
-	print(LogLevel::debug, "[DEBUG: Engine::setupSystemFunctions");
-#endif
-	builtinFunctions.insert(String(CONSTANT_FUNCTION_RETURN), SystemFunction::_return);
-	builtinFunctions.insert(String("are_available"), SystemFunction::_are_available);
-	//builtinFunctions.insert(String("own"), SystemFunction::_own); // handled as SRPS
-	builtinFunctions.insert(String("not"), SystemFunction::_not);
-	builtinFunctions.insert(String("all"), SystemFunction::_all);
-	builtinFunctions.insert(String("any"), SystemFunction::_any);
-	builtinFunctions.insert(String("nall"), SystemFunction::_nall);
-	builtinFunctions.insert(String("none"), SystemFunction::_none);
-	builtinFunctions.insert(String("xall"), SystemFunction::_xall);
-	builtinFunctions.insert(String("are_fn"), SystemFunction::_are_fn);
-	//builtinFunctions.insert(String("is_ptr"), SystemFunction::_is_ptr); // handled as SRPS
-	//builtinFunctions.insert(String("is_owner"), SystemFunction::_is_owner); // handled as SRPS
-	builtinFunctions.insert(String("are_empty"), SystemFunction::_are_empty);
-	builtinFunctions.insert(String("are_same"), SystemFunction::_are_same);
-	builtinFunctions.insert(String("member"), SystemFunction::_member);
-	builtinFunctions.insert(String("member_count"), SystemFunction::_member_count);
-	builtinFunctions.insert(String("is_member"), SystemFunction::_is_member);
-	builtinFunctions.insert(String("set_member"), SystemFunction::_set_member);
-	builtinFunctions.insert(String("member_list"), SystemFunction::_member_list);
-	builtinFunctions.insert(String("union"), SystemFunction::_union);
-	builtinFunctions.insert(String("type_of"), SystemFunction::_type);
-	builtinFunctions.insert(String("are_same_type"), SystemFunction::_are_same_type);
-	builtinFunctions.insert(String("are_type"), SystemFunction::_are_type);
-	builtinFunctions.insert(String("equal_type_value"), SystemFunction::_equal_type_value);
-	builtinFunctions.insert(String("typename_of"), SystemFunction::_typename);
-	builtinFunctions.insert(String("have_same_typename"), SystemFunction::_have_same_typename);
-	builtinFunctions.insert(String("ret_type"), SystemFunction::_function_return_type);
-	builtinFunctions.insert(String("are_nil"), SystemFunction::_are_nil);
-	builtinFunctions.insert(String("are_bool"), SystemFunction::_are_bool);
-	builtinFunctions.insert(String("are_string"), SystemFunction::_are_string);
-	builtinFunctions.insert(String("are_list"), SystemFunction::_are_list);
-	builtinFunctions.insert(String("are_number"), SystemFunction::_are_number);
-	builtinFunctions.insert(String("are_int"), SystemFunction::_are_integer);
-	builtinFunctions.insert(String("are_dcml"), SystemFunction::_are_decimal);
-	builtinFunctions.insert(String("assert"), SystemFunction::_assert);
-
-	builtinFunctions.insert(String("copy_of"), SystemFunction::_copy);
-	builtinFunctions.insert(String("realize"), SystemFunction::_construct_from_type);
-	builtinFunctions.insert(String("new"), SystemFunction::_construct_from_name);
-	builtinFunctions.insert(String("xwsv"), SystemFunction::_execute_with_alt_super);
-	builtinFunctions.insert(String("share_body"), SystemFunction::_share_body);
-
-	builtinFunctions.insert(String("list"), SystemFunction::_make_list);
-	builtinFunctions.insert(String("length"), SystemFunction::_list_size);
-	builtinFunctions.insert(String("append"), SystemFunction::_list_append);
-	builtinFunctions.insert(String("prepend"), SystemFunction::_list_prepend);
-	builtinFunctions.insert(String("insert"), SystemFunction::_list_insert);
-	builtinFunctions.insert(String("item_at"), SystemFunction::_list_get_item);
-	builtinFunctions.insert(String("erase"), SystemFunction::_list_remove);
-	builtinFunctions.insert(String("dump"), SystemFunction::_list_clear);
-	builtinFunctions.insert(String("swap"), SystemFunction::_list_swap);
-	builtinFunctions.insert(String("replace"), SystemFunction::_list_replace);
-	builtinFunctions.insert(String("sublist"), SystemFunction::_list_sublist);
-
-	builtinFunctions.insert(String("matching"), SystemFunction::_string_match);
-	builtinFunctions.insert(String("concat"), SystemFunction::_string_concat);
-
-	builtinFunctions.insert(String("equal"), SystemFunction::_num_equal);
-	builtinFunctions.insert(String("gt"), SystemFunction::_num_greater_than);
-	builtinFunctions.insert(String("gte"), SystemFunction::_num_greater_or_equal);
-	builtinFunctions.insert(String("lt"), SystemFunction::_num_less_than);
-	builtinFunctions.insert(String("lte"), SystemFunction::_num_less_or_equal);
-	builtinFunctions.insert(String("abs"), SystemFunction::_num_abs);
-#ifdef COPPER_ENABLE_EXTENDED_NAME_SET
-	builtinFunctions.insert(String("+"), SystemFunction::_num_add);
-	builtinFunctions.insert(String("-"), SystemFunction::_num_subtract);
-	builtinFunctions.insert(String("*"), SystemFunction::_num_multiply);
-	builtinFunctions.insert(String("/"), SystemFunction::_num_divide);
-	builtinFunctions.insert(String("%"), SystemFunction::_num_modulus);
-	builtinFunctions.insert(String("++"), SystemFunction::_num_incr);
-	builtinFunctions.insert(String("--"), SystemFunction::_num_decr);
-#else
-	// Alternative names
-	builtinFunctions.insert(String("add"), SystemFunction::_num_add);
-	builtinFunctions.insert(String("sbtr"), SystemFunction::_num_subtract);
-	builtinFunctions.insert(String("mult"), SystemFunction::_num_multiply);
-	builtinFunctions.insert(String("divd"), SystemFunction::_num_divide);
-	builtinFunctions.insert(String("mod"), SystemFunction::_num_modulus);
-	builtinFunctions.insert(String("incr"), SystemFunction::_num_incr);
-	builtinFunctions.insert(String("decr"), SystemFunction::_num_decr);
-#endif
-}
-
 //-------------------------------------
 //********** PARSING SYSTEM ***********
 
@@ -3272,9 +4176,11 @@ Engine::interpretToken(
 	if ( ! context.moveToFirstUnusedToken() )
 		return ParseResult::Done;
 
-	Token  currToken = context.peekAtToken();
+	const Token&  currToken = context.peekAtToken();
 
 	Opcode*  code = REAL_NULL;
+	const ReservedName*  reservedName;
+	Opcode::Type  srpsType;
 
 	switch( currToken.type ) {
 
@@ -3352,7 +4258,7 @@ Engine::interpretToken(
 		context.addNewOperation( new Opcode(Opcode::Terminal) );
 		addNewParseTask(
 			context.taskStack,
-			new IfStructureParseTask( context.outputStrand )
+			new IfStructureParseTask()
 		);
 		context.commitTokenUsage(); // Keep the "if"
 		return ParseResult::More;
@@ -3396,28 +4302,22 @@ Engine::interpretToken(
 		// by parsing them as unique tasks.
 
 		// Special names
-		if ( context.peekAtToken().name.equals(CONSTANT_TOKEN_OWN) ) {
-			addNewParseTask(
-				context.taskStack,
-				new SRPSParseTask(Opcode::Own)
-			);
-			context.commitTokenUsage();
-			return ParseResult::More;
-		}
-		// else
-		if ( context.peekAtToken().name.equals(CONSTANT_TOKEN_IS_OWNER) ) {
-			addNewParseTask(
-				context.taskStack,
-				new SRPSParseTask(Opcode::Is_owner)
-			);
-			context.commitTokenUsage();
-			return ParseResult::More;
-		}
-		// else
-		if ( context.peekAtToken().name.equals(CONSTANT_TOKEN_IS_PTR) ) {
+		reservedName = currToken.symbol.getReservedName();
+		if ( reservedName && reservedName->kind != ReservedName::Builtin ) {
+			switch( reservedName->kind ) {
+			case ReservedName::Own:
+				srpsType = Opcode::Own;
+				break;
+			case ReservedName::IsOwner:
+				srpsType = Opcode::Is_owner;
+				break;
+			default: // ReservedName::IsPointer (Keywords are not names)
+				srpsType = Opcode::Is_pointer;
+				break;
+			}
 			addNewParseTask(
 				context.taskStack,
-				new SRPSParseTask(Opcode::Is_pointer)
+				new SRPSParseTask(srpsType)
 			);
 			context.commitTokenUsage();
 			return ParseResult::More;
@@ -3426,7 +4326,7 @@ Engine::interpretToken(
 		// Regular names. Request more processing.
 		addNewParseTask(
 			context.taskStack,
-			new FuncFoundParseTask( currToken.name )
+			new FuncFoundParseTask( currToken.symbol )
 		);
 		context.commitTokenUsage();
 		return ParseResult::More;
@@ -3449,7 +4349,7 @@ Engine::interpretToken(
 	//---------------
 
 	case TT_string:
-		code = new Opcode(Opcode::CreateString, currToken.name, false);
+		code = new Opcode(Opcode::CreateString, currToken.getText(), false);
 		context.addNewOperation(code);
 		break;
 
@@ -3457,7 +4357,7 @@ Engine::interpretToken(
 
 	case TT_num_integer:
 		code = new Opcode(Opcode::CreateInteger);
-		code->setIntegerData(currToken.name.toInt());
+		code->setIntegerData(currToken.getText().toInt());
 		context.addNewOperation(code);
 		break;
 
@@ -3465,14 +4365,14 @@ Engine::interpretToken(
 
 	case TT_num_decimal:
 		code = new Opcode(Opcode::CreateDecimal);
-		code->setDecimalData(currToken.name.toDouble());
+		code->setDecimalData(currToken.getText().toDouble());
 		context.addNewOperation(code);
 		break;
 
 	//---------------
 	
 	case TT_binary:
-		code = new Opcode(Opcode::CreateString, currToken.name.convertBinary(), false);
+		code = new Opcode(Opcode::CreateString, currToken.getText().convertBinary(), false);
 		context.addNewOperation(code);
 		break;
 
@@ -3672,7 +4572,7 @@ Engine::ParseFunctionBuild_CollectParameters(
 	}
 
 	while( context.peekAtToken().type == TT_name ) {
-		task->paramName = context.peekAtToken().name;
+		task->paramName = context.peekAtToken().symbol;
 		// Check for valid tokens
 		context.commitTokenUsage();
 		context.moveToNextToken();
@@ -3919,7 +4819,7 @@ Engine::parseFuncFoundTask(
 #endif
 	ParseTask::Result::Value r;
 	
-	RobinHoodHash<SystemFunction::Value>::BucketData* sysFuncBucketData;
+	const ReservedName* reservedName;
 
 	switch( task->state ) {
 	case FuncFoundParseTask::Start:
@@ -3929,10 +4829,10 @@ Engine::parseFuncFoundTask(
 			return r;
 			
 		// Optimization: Track if this is a system function, so we don't need to match the name during runtime
-		sysFuncBucketData = builtinFunctions.getBucketData(task->code->getAddressData()->first());
-		if ( sysFuncBucketData )
+		reservedName = task->code->getAddressData()->first().getReservedName();
+		if ( reservedName && reservedName->kind == ReservedName::Builtin )
 		{
-			task->code->getAddressData()->sysFuncValue = sysFuncBucketData->item;
+			task->code->getAddressData()->sysFuncValue = reservedName->sysFunc;
 		}
 
 		// It is possible that this is a chain of member names, connected by the member link.
@@ -3940,7 +4840,7 @@ Engine::parseFuncFoundTask(
 			// Get the next name and restart
 			if ( context.moveToNextToken() ) {
 				if ( context.peekAtToken().type == TT_name ) {
-					task->code->appendAddressData( context.peekAtToken().name );
+					task->code->appendAddressData( context.peekAtToken().symbol );
 					context.commitTokenUsage();
 					// Next token should be member-link, assignment, pointer-assignment, or parambody-open
 					if ( context.moveToNextToken() ) {
@@ -4001,8 +4901,13 @@ Engine::parseFuncFoundTask(
 		case TT_parambody_open:
 			context.commitTokenUsage(); // Keep the parameter body open token
 			task->state = FuncFoundParseTask::VerifyParams;
-			task->code->setType( Opcode::FuncFound_call );
-			context.addOperation( task->code );
+			if ( task->code->getAddressData()->isSysFunc() ) {
+				// The SysCall opcode is added once the arguments have been counted.
+				task->isSysCall = true;
+			} else {
+				task->code->setType( Opcode::FuncFound_call );
+				context.addOperation( task->code );
+			}
 			if ( context.moveToNextToken() ) {
 				return ParseFuncFound_VerifyParams(task, context, srcDone);
 			} else {
@@ -4011,9 +4916,14 @@ Engine::parseFuncFoundTask(
 
 		case TT_immediate_run:
 			context.commitTokenUsage();
-			task->code->setType( Opcode::FuncFound_call );
-			context.addOperation( task->code );
-			context.addNewOperation( new Opcode( Opcode::FuncFound_finishCall ) );
+			if ( task->code->getAddressData()->isSysFunc() ) {
+				task->code->setType( Opcode::SysCall );
+				context.addOperation( task->code );
+			} else {
+				task->code->setType( Opcode::FuncFound_call );
+				context.addOperation( task->code );
+				context.addNewOperation( new Opcode( Opcode::FuncFound_finishCall ) );
+			}
 			context.addNewOperation( new Opcode( Opcode::Terminal ) ); // For incrementing to after the function call
 			return ParseTask::Result::task_done;
 
@@ -4138,7 +5048,7 @@ Engine::ParseFuncFound_VerifyParams(
 ) {
 #ifdef COPPER_DEBUG_ENGINE_MESSAGES
 	print(LogLevel::debug, "[DEBUG: Engine::ParseFuncFound_VerifyParams");
-	//std::printf("[ currToken.name = %s\n", context.peekAtToken().name.c_str());
+	//std::printf("[ currToken.name = %s\n", context.peekAtToken().getText().c_str());
 #endif
 	// Only for scanning
 	UInteger openBodies = 1;
@@ -4183,14 +5093,25 @@ Engine::ParseFuncFound_CollectParams(
 ) {
 #ifdef COPPER_DEBUG_ENGINE_MESSAGES
 	print(LogLevel::debug, "[DEBUG: Engine::ParseFuncFound_CollectParams");
-	//std::printf("[ currToken.name = %s\n", context.peekAtToken().name.c_str());
+	//std::printf("[ currToken.name = %s\n", context.peekAtToken().getText().c_str());
 #endif
 	// Current parsing state: After the first parameter-body-opener token.
 
 	if ( task->waitingOnAssignment ) {
-		context.addNewOperation(
-			new Opcode( Opcode::FuncFound_setParam )
-		);
+		if ( task->isSysCall ) {
+			if ( task->argCount == PARSER_SYSCALL_ARGS_MAX_COUNT ) {
+				print( LogLevel::error, EngineMessage::ExceededSysCallArgCountLimit );
+				return ParseTask::Result::syntax_error;
+			}
+			context.addNewOperation(
+				new Opcode( Opcode::SysCall_setParam )
+			);
+			++(task->argCount);
+		} else {
+			context.addNewOperation(
+				new Opcode( Opcode::FuncFound_setParam )
+			);
+		}
 		task->waitingOnAssignment = false;
 	}
 
@@ -4209,7 +5130,13 @@ Engine::ParseFuncFound_CollectParams(
 		task->openBodies--;
 		if ( task->openBodies == 0 ) {
 			context.commitTokenUsage();
-			context.addNewOperation( new Opcode( Opcode::FuncFound_finishCall ) );
+			if ( task->isSysCall ) {
+				task->code->setType( Opcode::SysCall );
+				task->code->setArgCount( task->argCount );
+				context.addOperation( task->code );
+			} else {
+				context.addNewOperation( new Opcode( Opcode::FuncFound_finishCall ) );
+			}
 			context.addNewOperation( new Opcode( Opcode::Terminal ) ); // for incrementing to after the call
 			return ParseTask::Result::task_done;
 		}
@@ -4449,8 +5376,8 @@ Engine::ParseIfStructure_ScanExecBody(
 		}
 	}
 #ifdef COPPER_DEBUG_ENGINE_MESSAGES
-	Token t = context.peekAtToken();
-	std::printf("[DEBUG: Engine::ParseIfStructure_ScanExecBody: Incomplete body, ending in token: %s, %u\n", t.name.c_str(), t.type);
+	const Token& t = context.peekAtToken();
+	std::printf("[DEBUG: Engine::ParseIfStructure_ScanExecBody: Incomplete body, ending in token: %s, %u\n", t.getText().c_str(), t.type);
 #endif
 	if ( srcDone ) {
 		//print(LogLevel::error, "Incomplete if-structure body.");
@@ -4461,6 +5388,36 @@ Engine::ParseIfStructure_ScanExecBody(
 	}
 }
 
+#ifdef COPPER_ENABLE_FUSED_CONDITIONS
+// Marks a condition ending in a call to a comparison or boolean built-in function
+// so that the call tests its arguments and jumps for the ConditionalGoto that follows.
+static void
+fuseConditionCall( OpStrand&  strand ) {
+	if ( strand.size() < 2 )
+		return;
+	const uint  callIndex = strand.size() - 2;
+	if ( strand.get(callIndex).getType() != Opcode::SysCall
+		|| strand.get(callIndex + 1).getType() != Opcode::Terminal )
+		return;
+
+	switch( strand.getAddressData( strand.get(callIndex) )->sysFuncValue ) {
+	case SystemFunction::_not:
+	case SystemFunction::_all:
+	case SystemFunction::_any:
+	case SystemFunction::_string_match:
+	case SystemFunction::_num_equal:
+	case SystemFunction::_num_greater_than:
+	case SystemFunction::_num_greater_or_equal:
+	case SystemFunction::_num_less_than:
+	case SystemFunction::_num_less_or_equal:
+		strand.setType( callIndex, Opcode::SysCall_condition );
+		break;
+	default:
+		break;
+	}
+}
+#endif
+
 // Lets a token generate an object and readies a conditional jump in case of false
 ParseTask::Result::Value
 Engine::ParseIfStructure_CreateCondition(
@@ -4485,10 +5442,13 @@ Engine::ParseIfStructure_CreateCondition(
 	case TT_parambody_close:
 		task->openBodies--;
 		if ( task->openBodies == 0 ) {
+#ifdef COPPER_ENABLE_FUSED_CONDITIONS
+			fuseConditionCall( *(context.outputStrand) );
+#endif
 			code = new Opcode(Opcode::ConditionalGoto);
-			context.addNewOperation( code );
 			// Since the code's jump has not been set yet, add it to the queue for setting
-			task->queueNewConditionalJump(code); // Jumps to the next section of the if-structure
+			// Jumps to the next section of the if-structure
+			task->queueNewConditionalJump( context.addNewOperation( code ) );
 			// Capture this and the next token
 			context.moveToNextToken(); // Should be the execution body opener
 #ifdef COPPER_STRICT_CHECKS
@@ -4534,8 +5494,7 @@ Engine::ParseIfStructure_CreateBody(
 			context.commitTokenUsage(); // Use this body-closing token
 			// Create an opcode at the end of the body for jumping to the end of the if-structure
 			code = new Opcode(Opcode::Goto);
-			context.addNewOperation( code );
-			task->queueNewFinalJumpCode(code);
+			task->queueNewFinalJumpCode( context.addNewOperation( code ) );
 
 			if ( task->atElse ) {
 				task->finalizeGotos( context );
@@ -4737,8 +5696,7 @@ Engine::ParseLoop_AwaitFinish(
 			context.commitTokenUsage();
 			// Add the re-loop goto
 			code = new Opcode(Opcode::Goto);
-			task->setGotoOpcodeToLoopStart(code);
-			context.addNewOperation(code);
+			task->setGotoOpcodeToLoopStart( context.outputStrand, context.addNewOperation(code) );
 
 			// Add the loop completion terminal
 			context.addNewOperation( new Opcode(Opcode::Terminal) );
@@ -4779,11 +5737,7 @@ Engine::ParseLoop_AddEndLoop(
 		task = taskIter->getTask();
 		if ( task->type == ParseTask::Loop ) {
 			code = new Opcode(Opcode::Goto);
-			((LoopStructureParseTask*)task)->queueFinalGoto(code);
-			context.addNewOperation(code);
-			// Unfortunately, adding the code as a new operation would delink it from the
-			// final goto queue if Opcodes are copied in the main constructor of OpcodeContainer.
-			// Hence, OpcodeContainer must use references.
+			((LoopStructureParseTask*)task)->queueFinalGoto( context.addNewOperation(code) );
 			return ParseResult::Done;
 		}
 	} while ( taskIter.prev() );
@@ -4818,8 +5772,7 @@ Engine::ParseLoop_AddLoopSkip(
 		task = taskIter->getTask();
 		if ( task->type == ParseTask::Loop ) {
 			code = new Opcode(Opcode::Goto);
-			((LoopStructureParseTask*)task)->setGotoOpcodeToLoopStart(code);
-			context.addNewOperation(code);
+			((LoopStructureParseTask*)task)->setGotoOpcodeToLoopStart( context.outputStrand, context.addNewOperation(code) );
 			return ParseResult::Done;
 		}
 	} while ( taskIter.prev() );
@@ -4902,7 +5855,7 @@ Engine::parseSRPS(
 
 	bool loop = true;
 	while ( context.peekAtToken().type == TT_name && loop ) {
-		addressCode->appendAddressData( context.peekAtToken().name );
+		addressCode->appendAddressData( context.peekAtToken().symbol );
 		context.moveToNextToken();
 		switch( context.peekAtToken().type ) {
 		case TT_parambody_close:
@@ -4933,6 +5886,321 @@ Engine::parseSRPS(
 }
 
 
+//============ Engine: optimization of compiled bodies ==========
+
+// Counts the messages given to it instead of printing them.
+// Built-in calls evaluated while optimizing must finish without any message to be replaced.
+struct MessageCounter : public Logger {
+	UInteger count;
+
+	MessageCounter() : count(0) {}
+	void print(const LogLevel::Value, const char*) { ++count; }
+	void print(const LogLevel::Value, const EngineMessage::Value) { ++count; }
+	void print(LogMessage) { ++count; }
+	void printTaskTrace( TaskType::Value, const String&, UInteger ) { ++count; }
+	void printStackTrace( const String&, UInteger ) { ++count; }
+};
+
+// Built-in functions whose result depends only on their arguments
+static bool
+isFoldableBuiltin( SystemFunction::Value  pFunction ) {
+	switch( pFunction ) {
+	case SystemFunction::_not:
+	case SystemFunction::_all:
+	case SystemFunction::_any:
+	case SystemFunction::_nall:
+	case SystemFunction::_none:
+	case SystemFunction::_xall:
+	case SystemFunction::_string_match:
+	case SystemFunction::_string_concat:
+	case SystemFunction::_num_equal:
+	case SystemFunction::_num_greater_than:
+	case SystemFunction::_num_greater_or_equal:
+	case SystemFunction::_num_less_than:
+	case SystemFunction::_num_less_or_equal:
+	case SystemFunction::_num_abs:
+	case SystemFunction::_num_add:
+	case SystemFunction::_num_subtract:
+	case SystemFunction::_num_multiply:
+	case SystemFunction::_num_divide:
+	case SystemFunction::_num_modulus:
+		return true;
+	default:
+		return false;
+	}
+}
+
+// Division and modulus by zero may stop the program, and folding would do so at compile-time
+// even if the call is never run. Any divisor that is zero when truncated counts as zero.
+// Parameters pStart and pEnd are the first argument and the call instruction.
+static bool
+hasZeroDivisor( OpStrand&  strand, uint  pStart, uint  pEnd ) {
+	const SystemFunction::Value  function = strand.getAddressData(strand.get(pEnd))->sysFuncValue;
+	if ( function != SystemFunction::_num_divide && function != SystemFunction::_num_modulus )
+		return false;
+	uint  i = pStart + 2; // The first argument is the dividend
+	for (; i < pEnd; i += 2) {
+		switch( strand.get(i).getType() ) {
+		case Opcode::CreateInteger:
+		case Opcode::CreateDecimal:
+			if ( ((NumericObject*)strand.getLiteral(strand.get(i)))->getIntegerValue() == 0 )
+				return true;
+			break;
+		default:
+			break;
+		}
+	}
+	return false;
+}
+
+// Marks the targets of gotos. Gotos continue at the instruction after their target.
+// pTarget must have room for strand.size() items.
+static void
+findJumpTargets( const OpStrand&  strand, bool*  pTarget ) {
+	const uint  size = strand.size();
+	uint  i = 0;
+	int  target;
+	for (; i < size; ++i)
+		pTarget[i] = false;
+	for ( i = 0; i < size; ++i ) {
+		if ( ! strand.get(i).isJump() )
+			continue;
+		target = (int)i + strand.get(i).getJump();
+		if ( target >= 0 && target < (int)size )
+			pTarget[target] = true;
+	}
+}
+
+void
+Engine::optimize( OpStrand&  strand ) {
+#ifdef COPPER_DEBUG_ENGINE_MESSAGES
+	print(LogLevel::debug, "[DEBUG: Engine::optimize");
+#endif
+	// Calls nested in the arguments of others come first, so they are folded first.
+	uint  i = 0;
+	uint  resultIndex;
+	for (; i < strand.size(); ++i) {
+		switch( strand.get(i).getType() ) {
+		case Opcode::SysCall:
+		case Opcode::SysCall_condition:
+			if ( foldBuiltinCall(strand, i, resultIndex) )
+				i = resultIndex;
+			break;
+		default:
+			break;
+		}
+	}
+	threadJumps(strand);
+	while ( removeUnreachableCode(strand) );
+	removeRedundantTerminals(strand);
+}
+
+bool
+Engine::foldBuiltinCall( OpStrand&  strand, uint  callIndex, uint&  resultIndex ) {
+	const Instruction&  call = strand.get(callIndex);
+	VarAddress*  address = strand.getAddressData(call);
+	const uint  argCount = call.argCount;
+
+	if ( ! isFoldableBuiltin(address->sysFuncValue) || ! address->hasOne() )
+		return false;
+	if ( argCount == 0 || callIndex < argCount * 2 )
+		return false;
+
+	// Each argument must be a literal followed by the parameter-setting instruction,
+	// and no goto may continue in the middle of the call.
+	const uint  start = callIndex - argCount * 2;
+	uint  i = start;
+	for (; i < callIndex; i += 2) {
+		if ( strand.get(i + 1).getType() != Opcode::SysCall_setParam )
+			return false;
+		switch( strand.get(i).getType() ) {
+		case Opcode::CreateBoolTrue:
+		case Opcode::CreateBoolFalse:
+		case Opcode::CreateString:
+		case Opcode::CreateInteger:
+		case Opcode::CreateDecimal:
+			break;
+		default:
+			return false;
+		}
+	}
+	if ( hasZeroDivisor(strand, start, callIndex) )
+		return false;
+	// The terminal after the call is only needed by the call.
+	uint  end = callIndex;
+	if ( callIndex + 1 < strand.size() && strand.get(callIndex + 1).getType() == Opcode::Terminal )
+		end = callIndex + 1;
+	bool*  isTarget = new bool[strand.size()];
+	findJumpTargets(strand, isTarget);
+	for ( i = start; i <= end; ++i ) {
+		if ( isTarget[i] )
+			break;
+	}
+	delete[] isTarget;
+	if ( i <= end )
+		return false;
+
+	FuncFoundTask  task(address);
+	Object*  arg;
+	for ( i = start; i < callIndex; i += 2 ) {
+		arg = createLiteralObject(strand, strand.get(i));
+		task.addArg(arg);
+		arg->deref();
+	}
+
+	// Run the call without disturbing the engine. Any message means the call must be left for run-time.
+	RefPtr<Object>  savedLastObject;
+	savedLastObject.set( lastObject.raw() );
+	Logger*  savedLogger = logger;
+	MessageCounter  messages;
+	logger = &messages;
+	OpStrandStackIter  unusedIter = activeOpcodeStrandStack->end();
+	const FuncExecReturn::Value  result = setupBuiltinFunctionExecution(task, unusedIter);
+	logger = savedLogger;
+	RefPtr<Object>  value;
+	value.set( lastObject.raw() );
+	lastObject.set( savedLastObject.raw() );
+
+	if ( result != FuncExecReturn::Ran || messages.count > 0 )
+		return false;
+	if ( ! strand.replaceWithValue(start, end, value.raw()) )
+		return false;
+	resultIndex = start;
+	return true;
+}
+
+Object*
+Engine::createLiteralObject( OpStrand&  strand, const Instruction&  code ) {
+	Object*  object;
+	switch( code.getType() ) {
+	case Opcode::CreateBoolTrue:
+		object = trueObject;
+		break;
+	case Opcode::CreateBoolFalse:
+		object = falseObject;
+		break;
+	case Opcode::CreateString:
+		return new StringObject( strand.getNameData(code) );
+	case Opcode::CreateInteger:
+	case Opcode::CreateDecimal:
+		object = strand.getLiteral(code);
+		break;
+	default:
+		return REAL_NULL;
+	}
+	object->ref();
+	return object;
+}
+
+// Moves the targets of gotos past terminals and other gotos they would otherwise pass through.
+void
+Engine::threadJumps( OpStrand&  strand ) {
+	const uint  size = strand.size();
+	uint  i = 0;
+	uint  steps;
+	int  target;
+	int  landing;
+	for (; i < size; ++i) {
+		if ( ! strand.get(i).isJump() )
+			continue;
+		target = (int)i + strand.get(i).getJump();
+		// Empty loops jump in a circle, so the steps are limited.
+		for ( steps = 0; steps < size; ++steps ) {
+			landing = target + 1;
+			if ( landing < 0 || landing >= (int)size )
+				break;
+			if ( strand.get(landing).getType() == Opcode::Terminal )
+				target = landing;
+			else if ( strand.get(landing).getType() == Opcode::Goto )
+				target = landing + strand.get(landing).getJump();
+			else
+				break;
+		}
+		strand.setJump(i, (uint)target);
+	}
+}
+
+// Removes the instructions after gotos and "ret" that no goto continues at.
+// Returns true if any were removed.
+bool
+Engine::removeUnreachableCode( OpStrand&  strand ) {
+	const uint  size = strand.size();
+	bool*  isTarget = new bool[size];
+	findJumpTargets(strand, isTarget);
+	uint  i = 0;
+	uint  end;
+	bool  removed = false;
+	for (; i < size; ++i) {
+		if ( strand.get(i).getType() != Opcode::Goto
+			&& !( strand.get(i).getType() == Opcode::SysCall
+				&& strand.getAddressData(strand.get(i))->sysFuncValue == SystemFunction::_return )
+		) {
+			continue;
+		}
+		end = i + 1;
+		while ( end < size && ! isTarget[end - 1] )
+			++end;
+		if ( end > i + 1 ) {
+			strand.removeRange(i + 1, end - i - 1);
+			removed = true;
+			break; // Positions have changed
+		}
+	}
+	delete[] isTarget;
+	return removed;
+}
+
+// Removes terminals that are not needed after a function call (where the engine resumes)
+// and gotos to the next instruction. Gotos targeting a removed instruction are moved to the
+// instruction before it, so they still continue at the same place. For that reason, a target at
+// the start of the strand is kept.
+void
+Engine::removeRedundantTerminals( OpStrand&  strand ) {
+	bool  isTarget;
+	uint  i = strand.size();
+	uint  j;
+	// Going backwards, removals do not change the positions still to be checked.
+	while ( i > 0 ) {
+		--i;
+		switch( strand.get(i).getType() ) {
+		case Opcode::Terminal:
+			if ( i > 0 ) {
+				switch( strand.get(i - 1).getType() ) {
+				case Opcode::FuncFound_finishCall:
+				case Opcode::FuncFound_finishTailCall:
+				case Opcode::SysCall:
+				case Opcode::SysCall_condition:
+					continue;
+				default:
+					break;
+				}
+			}
+			break;
+
+		case Opcode::Goto:
+			if ( strand.get(i).getJump() != 0 )
+				continue;
+			break;
+
+		default:
+			continue;
+		}
+		if ( i == 0 ) {
+			isTarget = false;
+			for ( j = 0; j < strand.size(); ++j ) {
+				if ( strand.get(j).isJump() && (int)j + strand.get(j).getJump() == 0 ) {
+					isTarget = true;
+					break;
+				}
+			}
+			if ( isTarget )
+				continue;
+		}
+		strand.removeRange(i, 1);
+	}
+}
+
+
 //============ Engine: operation execution code ==========
 
 void
@@ -4941,8 +6209,8 @@ Engine::addNewTaskToStack(
 ) {
 	//if ( isNull(t) )
 	//	throw NullTaskException();
-	taskStack.push_back(TaskContainer(t));
-	// TaskContainer does NOT reference count in its default constructor.
+	taskStack.push(t);
+	// The stack takes over the reference of the new task.
 #ifdef COPPER_DEBUG_ENGINE_MESSAGES
 	std::printf("[DEBUG TaskStack.size = %lu\n", taskStack.size());
 #endif
@@ -4952,12 +6220,35 @@ Task*
 Engine::getLastTask() {
 	if ( ! taskStack.has() )
 		throw EmptyTaskStackException();
-	return &(taskStack.getLast().getTask());
+	return taskStack.getLast();
 }
 
 void
 Engine::popLastTask() {
-	taskStack.pop();
+	// Finished function calls are emptied and kept for reuse. Nothing else holds tasks, so this is safe.
+	if ( ! taskStack.has() )
+		return;
+	if ( taskStack.getLast()->name == TaskType::FuncFound
+		&& spareFuncFoundTasks.size() < CU_SPARE_FUNC_FOUND_TASKS
+	) {
+		Task* task = taskStack.takeLast();
+		((FuncFoundTask*)task)->release();
+		spareFuncFoundTasks.push(task);
+	} else {
+		taskStack.pop();
+	}
+}
+
+FuncFoundTask*
+Engine::createFuncFoundTask(
+	VarAddress*	address
+) {
+	if ( spareFuncFoundTasks.has() ) {
+		FuncFoundTask* task = (FuncFoundTask*)spareFuncFoundTasks.takeLast();
+		task->setAddress(address);
+		return task;
+	}
+	return new FuncFoundTask(address);
 }
 
 void
@@ -4966,7 +6257,7 @@ Engine::addOpStrandToStack(
 ) {
 	if ( isNull(strand) )
 		throw EmptyOpstrandException();
-	activeOpcodeStrandStack->push_back( OpStrandContainer(strand) );
+	activeOpcodeStrandStack->push_back( OpStrandContainer(strand, false, sysCallArgs.size()) );
 }
 
 
@@ -4999,19 +6290,19 @@ Engine::execute() {
 
 	// This could cause problems as the same opcode might be run twice if the execution is paused
 	// or stopped due to lack of tokens:
-	OpStrandIter* currOp;
+	OpStrandContainer* currStrand;
 	// To counter this, a Terminal opcode is appended to the end of the global strand.
 
 	bool hasNextToken;
 	do {
-		currOp = &(opcodeStrandStackIter->getCurrOp());
+		currStrand = &(*opcodeStrandStackIter);
 
-		if ( currOp->has() ) {
+		if ( currStrand->has() ) {
 			// Otherwise, process
 			do {
 				hasNextToken = true;
 
-				switch( operate( opcodeStrandStackIter, *currOp ) ) {
+				switch( operate( opcodeStrandStackIter, *currStrand ) ) {
 				case ExecutionResult::Ok:
 					break;
 
@@ -5030,8 +6321,8 @@ Engine::execute() {
 					return EngineResult::Done;
 
 				case ExecutionResult::Reset:
-					currOp = &(opcodeStrandStackIter->getCurrOp());
-					currOp->reset();
+					currStrand = &(*opcodeStrandStackIter);
+					currStrand->reset();
 					continue;
 
 				default:
@@ -5039,12 +6330,12 @@ Engine::execute() {
 					break;
 				}
 
-				hasNextToken = currOp->next();
+				hasNextToken = currStrand->next();
 			} while ( hasNextToken );
 		}
 
 		// A user function may have been called at the end of another function,
-		// which results in the current operation iterator being at the end of the strand
+		// which results in the current operation index being at the end of the strand
 		// when execute returns to it. This would cause the last opcode to execute again,
 		// which is wrong. To avoid this, we continue to pop the stack until the global
 		// strand level. The global strand must not be popped, so we just add a terminal
@@ -5057,21 +6348,23 @@ Engine::execute() {
 					// (Otherwise, there would be a memory leak.)
 					// This is also for preventing all other operations from being repeated.
 					globalParserContext.addNewOperation( new Opcode(Opcode::Terminal) );
-					currOp->next(); //... and go to it.
+					currStrand->next(); //... and go to it.
 				}
 				break;
 			}
 
 			// Not at the global opcodes strand, so it's safe to pop the strand
 			// Functions should pop variable/scope stack contexts.
+			// Arguments of built-in calls left unfinished by a return are also dropped.
+			releaseSysCallArgs( currStrand->getArgBase() );
 			stack.pop();
 			activeOpcodeStrandStack->pop();
 			opcodeStrandStackIter.makeLast();
-			currOp = &(opcodeStrandStackIter->getCurrOp());
+			currStrand = &(*opcodeStrandStackIter);
 
-		} while ( opcodeStrandStackIter->getCurrOp().atEnd() );
+		} while ( currStrand->atEnd() );
 
-	} while ( ! opcodeStrandStackIter.atStart() || ! currOp->atEnd() );
+	} while ( ! opcodeStrandStackIter.atStart() || ! currStrand->atEnd() );
 
 	//printGlobalStrand();
 
@@ -5088,21 +6381,81 @@ Engine::execute() {
 	return EngineResult::Ok;
 }
 
+// Opcode dispatch
+// With computed goto, operate() keeps running the opcodes of the current strand, jumping directly
+// from one handler to the next, until an opcode needs execute() (such as for a function call or
+// an error) or the end of the strand is reached. Otherwise, it runs one opcode per call.
+#ifdef COPPER_ENABLE_COMPUTED_GOTO
+#define COPPER_OPCODE_CASE(x)	case Opcode::x: opcode_##x:
+#define COPPER_OPCODE_NEXT \
+	if ( opStrand.next() ) { \
+		opcode = opStrand.getCurrOp(); \
+		goto *dispatchTable[opcode.type]; \
+	} \
+	break;
+#else
+#define COPPER_OPCODE_CASE(x)	case Opcode::x:
+#define COPPER_OPCODE_NEXT	break;
+#endif
+
 ExecutionResult::Value
 Engine::operate(
 	OpStrandStackIter&	opStrandStackIter,
-	OpStrandIter&		opIter // was using Opcode&
+	OpStrandContainer&	opStrand
 ) {
 #ifdef COPPER_DEBUG_ENGINE_MESSAGES
 	print(LogLevel::debug, "[DEBUG: Engine::operate");
 #endif
-	//const Opcode* opcode = opIter->getOp();
-	Opcode* opcode = opIter->getOp();
+	// Copied because the strand may grow (and move) while the instruction is being run
+	Instruction opcode = opStrand.getCurrOp();
+	OpStrand* strand = opStrand.getCurrStrand();
 	Task* task;
 	Variable* variable;
-
-	switch( opcode->getType() ) {
-	case Opcode::Exit:
+	Function* function;
+	FuncExecReturn::Value funcResult;
+	bool tailCall;
+
+#ifdef COPPER_ENABLE_COMPUTED_GOTO
+	// Must be in the same order as Opcode::Type
+	static void* const dispatchTable[] = {
+		&&opcode_Exit,
+		&&opcode_FuncBuild_start,
+		&&opcode_FuncBuild_createRegularParam,
+		&&opcode_FuncBuild_assignToVar,
+		&&opcode_FuncBuild_pointerAssignToVar,
+		&&opcode_FuncBuild_execBody,
+		&&opcode_FuncBuild_end,
+		&&opcode_FuncFound_access,
+		&&opcode_FuncFound_accessLocal,
+		&&opcode_FuncFound_accessGlobal,
+		&&opcode_FuncFound_assignment,
+		&&opcode_FuncFound_pointerAssignment,
+		&&opcode_FuncFound_call,
+		&&opcode_FuncFound_callDirect,
+		&&opcode_FuncFound_setParam,
+		&&opcode_FuncFound_finishCall,
+		&&opcode_FuncFound_finishTailCall,
+		&&opcode_FuncFound_finishUserCall,
+		&&opcode_FuncFound_finishUserTailCall,
+		&&opcode_SysCall_setParam,
+		&&opcode_SysCall,
+		&&opcode_SysCall_condition,
+		&&opcode_Terminal,
+		&&opcode_Goto,
+		&&opcode_ConditionalGoto,
+		&&opcode_Own,
+		&&opcode_Is_owner,
+		&&opcode_Is_pointer,
+		&&opcode_CreateBoolTrue,
+		&&opcode_CreateBoolFalse,
+		&&opcode_CreateString,
+		&&opcode_CreateInteger,
+		&&opcode_CreateDecimal
+	};
+#endif
+
+	switch( opcode.getType() ) {
+	COPPER_OPCODE_CASE(Exit)
 #ifdef COPPER_OPCODE_DEBUGGING
 		print(LogLevel::debug, "[DEBUG: Execute opcode Exit");
 #endif
@@ -5110,72 +6463,72 @@ Engine::operate(
 
 	//------- Opcodes for building an object-function
 
-	case Opcode::FuncBuild_start:
+	COPPER_OPCODE_CASE(FuncBuild_start)
 #ifdef COPPER_OPCODE_DEBUGGING
 		print(LogLevel::debug, "[DEBUG: Execute opcode FuncBuild_start");
 #endif
 		// Should create the function and scope
 		addNewTaskToStack( new FuncBuildTask() );
-		break;
+		COPPER_OPCODE_NEXT
 
-	case Opcode::FuncBuild_createRegularParam:
+	COPPER_OPCODE_CASE(FuncBuild_createRegularParam)
 #ifdef COPPER_OPCODE_DEBUGGING
 		print(LogLevel::debug, "[DEBUG: Execute opcode FuncBuild_createRegularParam");
 #endif
 		task = getLastTask();
 		if ( task->name == TaskType::FuncBuild ) {
-			((FuncBuildTask*)task)->function->addParam( opcode->getNameData() );
+			((FuncBuildTask*)task)->function->addParam( opcode.getSymbolData() );
 		} else {
 			throw BadOpcodeException(Opcode::FuncBuild_createRegularParam);
 		}
-		break;
+		COPPER_OPCODE_NEXT
 
-	case Opcode::FuncBuild_assignToVar:
+	COPPER_OPCODE_CASE(FuncBuild_assignToVar)
 #ifdef COPPER_OPCODE_DEBUGGING
 		print(LogLevel::debug, "[DEBUG: Execute opcode FuncBuild_assignToVar");
 #endif
 		task = getLastTask();
 		if ( task->name == TaskType::FuncBuild ) {
 			((FuncBuildTask*)task)->function->getPersistentScope().setVariableFrom(
-				opcode->getNameData(),
+				opcode.getSymbolData(),
 				lastObject.raw(),
 				false
 			);
 		} else {
 			throw BadOpcodeException(Opcode::FuncBuild_assignToVar);
 		}
-		break;
+		COPPER_OPCODE_NEXT
 
-	case Opcode::FuncBuild_pointerAssignToVar:
+	COPPER_OPCODE_CASE(FuncBuild_pointerAssignToVar)
 #ifdef COPPER_OPCODE_DEBUGGING
 		print(LogLevel::debug, "[DEBUG: Execute opcode FuncBuild_pointerAssignToVar");
 #endif
 		task = getLastTask();
 		if ( task->name == TaskType::FuncBuild ) {
 			((FuncBuildTask*)task)->function->getPersistentScope().setVariableFrom(
-				opcode->getNameData(),
+				opcode.getSymbolData(),
 				lastObject.raw(),
 				true
 			);
 		} else {
 			throw BadOpcodeException(Opcode::FuncBuild_pointerAssignToVar);
 		}
-		break;
+		COPPER_OPCODE_NEXT
 
-	case Opcode::FuncBuild_execBody:
+	COPPER_OPCODE_CASE(FuncBuild_execBody)
 #ifdef COPPER_OPCODE_DEBUGGING
 		print(LogLevel::debug, "[DEBUG: Execute opcode FuncBuild_execBody");
 #endif
 		task = getLastTask();
 		if ( task->name == TaskType::FuncBuild ) {
 			// Should check for function existence, but if there is no function, there is an internal failure
-			((FuncBuildTask*)task)->function->body.set( opcode->getBody() );
+			((FuncBuildTask*)task)->function->body.set( strand->getBody(opcode) );
 		} else {
 			throw BadOpcodeException(Opcode::FuncBuild_execBody);
 		}
-		break;
+		COPPER_OPCODE_NEXT
 
-	case Opcode::FuncBuild_end:
+	COPPER_OPCODE_CASE(FuncBuild_end)
 #ifdef COPPER_OPCODE_DEBUGGING
 		print(LogLevel::debug, "[DEBUG: Execute opcode FuncBuild_end");
 #endif
@@ -5188,46 +6541,90 @@ Engine::operate(
 		} else {
 			throw BadOpcodeException(Opcode::FuncBuild_end);
 		}
-		break;
+		COPPER_OPCODE_NEXT
 
 	//-------- Opcodes for when an address has been found
 
-	case Opcode::FuncFound_access:
+	COPPER_OPCODE_CASE(FuncFound_accessLocal)
+	COPPER_OPCODE_CASE(FuncFound_accessGlobal)
+#ifdef COPPER_OPCODE_DEBUGGING
+		print(LogLevel::debug, "[DEBUG: Execute quickened opcode FuncFound_access");
+#endif
+#ifdef COPPER_ENABLE_QUICKENING
+		variable = findQuickenedVariable( opcode.getType(), *(strand->getAddressData(opcode)) );
+		if ( notNull(variable) ) {
+			lastObject.set( variable->getRawContainer() );
+			COPPER_OPCODE_NEXT
+		}
+#endif
+		// Otherwise, run (and quicken) the opcode as FuncFound_access.
+		CU_FALLTHROUGH;
+
+	COPPER_OPCODE_CASE(FuncFound_access)
 #ifdef COPPER_OPCODE_DEBUGGING
 		print(LogLevel::debug, "[DEBUG: Execute opcode FuncFound_access");
 #endif
-		variable = resolveVariableAddress( *(opcode->getAddressData()) );
+		variable = resolveVariableAddress( *(strand->getAddressData(opcode)) );
 
 		if ( notNull(variable) ) {
 			lastObject.set( variable->getRawContainer() );
 		} else {
-			lastObject.setWithoutRef( new NilObject() ); // was new FunctionObject, but that's pointless
+			setLastObjectNil(); // was new FunctionObject, but that's pointless
 		}
-		break;
+#ifdef COPPER_ENABLE_QUICKENING
+		quickenAccess( opStrand, *(strand->getAddressData(opcode)) );
+#endif
+		COPPER_OPCODE_NEXT
 
-	case Opcode::FuncFound_assignment:
+	COPPER_OPCODE_CASE(FuncFound_assignment)
 #ifdef COPPER_OPCODE_DEBUGGING
 		print(LogLevel::debug, "[DEBUG: Execute opcode FuncFound_assignment");
 #endif
-		setVariableByAddress( *(opcode->getAddressData()), lastObject.raw(), false );
-		break;
+		setVariableByAddress( *(strand->getAddressData(opcode)), lastObject.raw(), false );
+		COPPER_OPCODE_NEXT
 
-	case Opcode::FuncFound_pointerAssignment:
+	COPPER_OPCODE_CASE(FuncFound_pointerAssignment)
 #ifdef COPPER_OPCODE_DEBUGGING
 		print(LogLevel::debug, "[DEBUG: Execute opcode FuncFound_pointerAssignment");
 #endif
-		setVariableByAddress( *(opcode->getAddressData()), lastObject.raw(), true );
-		break;
+		setVariableByAddress( *(strand->getAddressData(opcode)), lastObject.raw(), true );
+		COPPER_OPCODE_NEXT
+
+	COPPER_OPCODE_CASE(FuncFound_callDirect)
+#ifdef COPPER_OPCODE_DEBUGGING
+		print(LogLevel::debug, "[DEBUG: Execute opcode FuncFound_callDirect");
+#endif
+#ifdef COPPER_ENABLE_QUICKENING
+		variable = findDirectCallVariable( *(strand->getAddressData(opcode)) );
+		if ( notNull(variable) ) {
+			function = variable->getFunction(logger);
+			// Functions returning a constant (such as those of data variables) are run
+			// as in setupUserFunctionExecution() but without a task.
+			if ( function->constantReturn ) {
+				lastObject.set( function->result.raw() );
+				opStrand.next(); // Skip the finishing opcode
+				opStrand.next(); // Increment to the Terminal
+				COPPER_OPCODE_NEXT
+			}
+		} else {
+			opStrand.getCurrStrand()->setType( opStrand.getIndex(), Opcode::FuncFound_call );
+		}
+#endif
+		// Otherwise, the call is run with a task as by FuncFound_call.
+		CU_FALLTHROUGH;
 
-	case Opcode::FuncFound_call:
+	COPPER_OPCODE_CASE(FuncFound_call)
 #ifdef COPPER_OPCODE_DEBUGGING
 		print(LogLevel::debug, "[DEBUG: Execute opcode FuncFound_call");
 #endif
-		//addNewTaskToStack( new FuncFoundTask( *(opcode->getAddressData()) ) );
-		addNewTaskToStack( new FuncFoundTask( opcode->getAddressData() ) );
-		break;
+		//addNewTaskToStack( new FuncFoundTask( *(strand->getAddressData(opcode)) ) );
+		addNewTaskToStack( createFuncFoundTask( strand->getAddressData(opcode) ) );
+#ifdef COPPER_ENABLE_QUICKENING
+		quickenFoundCall( opStrand, *(strand->getAddressData(opcode)) );
+#endif
+		COPPER_OPCODE_NEXT
 
-	case Opcode::FuncFound_setParam:
+	COPPER_OPCODE_CASE(FuncFound_setParam)
 #ifdef COPPER_OPCODE_DEBUGGING
 		print(LogLevel::debug, "[DEBUG: Execute opcode FuncFound_setParam");
 #endif
@@ -5237,16 +6634,33 @@ Engine::operate(
 		} else {
 			throw BadOpcodeException(Opcode::FuncFound_setParam);
 		}
-		break;
+		COPPER_OPCODE_NEXT
 
-	case Opcode::FuncFound_finishCall:
+	COPPER_OPCODE_CASE(FuncFound_finishCall)
+	COPPER_OPCODE_CASE(FuncFound_finishTailCall)
+	COPPER_OPCODE_CASE(FuncFound_finishUserCall)
+	COPPER_OPCODE_CASE(FuncFound_finishUserTailCall)
 #ifdef COPPER_OPCODE_DEBUGGING
 		print(LogLevel::debug, "[DEBUG: Execute opcode FuncFound_finishCall");
 #endif
 		task = getLastTask();
 		if ( task->name == TaskType::FuncFound ) {
-			opIter.next(); // Increment to the Terminal
-			switch( setupFunctionExecution(*((FuncFoundTask*)task), opStrandStackIter) ) {
+			tailCall = opcode.getType() == Opcode::FuncFound_finishTailCall
+				|| opcode.getType() == Opcode::FuncFound_finishUserTailCall;
+#ifdef COPPER_ENABLE_QUICKENING
+			// Quickened while opStrand is still at the opcode
+			if ( quickenCall( opStrand, ((FuncFoundTask*)task)->getAddress() ) ) {
+				opStrand.next(); // Increment to the Terminal
+				setLastObjectNil(); // Default return, as in setupFunctionExecution()
+				funcResult = setupUserFunctionExecution(*((FuncFoundTask*)task), opStrandStackIter, tailCall);
+			} else
+#endif
+			{
+				opStrand.next(); // Increment to the Terminal
+				funcResult = setupFunctionExecution(*((FuncFoundTask*)task), opStrandStackIter, tailCall);
+			}
+			// For tail calls, opStrand may be popped, so it must not be used after a Reset.
+			switch( funcResult ) {
 
 			case FuncExecReturn::Ran:
 				popLastTask();
@@ -5272,7 +6686,7 @@ Engine::operate(
 			case FuncExecReturn::Return:
 				popLastTask();
 				// Pop opcode stack and reset the iterator or...
-				opIter.makeLast(); // have the engine pop the opcode iterator itself
+				opStrand.makeLast(); // have the engine pop the opcode iterator itself
 				break;
 
 			case FuncExecReturn::NoMatch:
@@ -5289,24 +6703,111 @@ Engine::operate(
 		}
 		break;
 
+	//-------- Opcodes for calls to built-in functions
+
+	COPPER_OPCODE_CASE(SysCall_setParam)
+#ifdef COPPER_OPCODE_DEBUGGING
+		print(LogLevel::debug, "[DEBUG: Execute opcode SysCall_setParam");
+#endif
+		// Always pushed (even if null) so that SysCall can count back to its first argument
+		if ( lastObject.raw() )
+			lastObject.raw()->ref();
+		sysCallArgs.push_back( lastObject.raw() );
+		COPPER_OPCODE_NEXT
+
+	COPPER_OPCODE_CASE(SysCall_condition)
+#ifdef COPPER_OPCODE_DEBUGGING
+		print(LogLevel::debug, "[DEBUG: Execute opcode SysCall_condition");
+#endif
+		{
+			const uint  argStart = sysCallArgs.size() - opcode.argCount;
+			bool  result;
+			if ( testCondition( strand->getAddressData(opcode)->sysFuncValue, argStart, result ) ) {
+				releaseSysCallArgs(argStart);
+				setLastObjectBool(result); // As the call would have
+				opStrand.next(); // Terminal
+				opStrand.next(); // ConditionalGoto
+				// Jump when false, as the ConditionalGoto does
+				if ( ! result )
+					opStrand.jump( opStrand.getCurrOp().getJump() );
+				COPPER_OPCODE_NEXT
+			}
+		}
+		// Otherwise, run the call normally and let the ConditionalGoto check its result.
+		CU_FALLTHROUGH;
+
+	COPPER_OPCODE_CASE(SysCall)
+#ifdef COPPER_OPCODE_DEBUGGING
+		print(LogLevel::debug, "[DEBUG: Execute opcode SysCall");
+#endif
+		{
+			// The task is never put on the task stack, and the arguments are moved into it
+			// from the top of the argument stack (along with their references).
+			FuncFoundTask  sysTask( strand->getAddressData(opcode) );
+			const uint  argStart = sysCallArgs.size() - opcode.argCount;
+			uint  a = argStart;
+			for (; a < sysCallArgs.size(); ++a) {
+				if ( notNull(sysCallArgs.get(a)) )
+					sysTask.args.push_back( sysCallArgs.get(a) );
+			}
+			sysCallArgs.truncate(argStart);
+
+			opStrand.next(); // Increment to the Terminal
+			setLastObjectNil(); // Default return, as in setupFunctionExecution()
+			switch( setupBuiltinFunctionExecution(sysTask, opStrandStackIter) ) {
+			case FuncExecReturn::Ran:
+				return ExecutionResult::Ok;
+
+			case FuncExecReturn::Reset:
+				return ExecutionResult::Reset;
+
+			case FuncExecReturn::ErrorOnRun:
+#ifdef COPPER_DEBUG_ENGINE_MESSAGES
+				print(LogLevel::debug, "[DEBUG: Function call exited with error.");
+#endif
+				if ( stackTracePrintingEnabled ) {
+					printTaskTrace();
+					if ( notNull(logger) ) // The call is not on the task stack
+						logger->printTaskTrace(
+							TaskType::FuncFound,
+							addressToString( sysTask.getAddress() ),
+							(UInteger)taskStack.size() + 1
+						);
+					printStackTrace();
+				}
+				return ExecutionResult::Error;
+
+			case FuncExecReturn::ExitCalled:
+				return ExecutionResult::Done;
+
+			case FuncExecReturn::Return:
+				opStrand.makeLast(); // have the engine pop the opcode iterator itself
+				break;
+
+			case FuncExecReturn::NoMatch:
+			default:
+				print(LogLevel::debug, "SYSTEM ERROR: Function failed to call in setupBuiltinFunctionExecution.");
+				throw BadFuncFoundTaskException();
+			}
+		}
+		break;
+
 	//------ Opcodes for if-structures, loops, and goto operations
 
-	case Opcode::Terminal:
+	COPPER_OPCODE_CASE(Terminal)
 #ifdef COPPER_OPCODE_DEBUGGING
 		print(LogLevel::debug, "[DEBUG: Execute opcode Terminal");
 #endif
-		break;
+		COPPER_OPCODE_NEXT
 
-	case Opcode::Goto:
+	COPPER_OPCODE_CASE(Goto)
 #ifdef COPPER_OPCODE_DEBUGGING
 		print(LogLevel::debug, "[DEBUG: Execute opcode Goto");
 #endif
-		// Here we cheat and cast to volatile because we don't have a const iterator for the list
-		//opIter.set( ((const Opcode*)opcode)->getOpStrandIter() );
-		opIter.set( opcode->getOpStrandIter() );
-		break;
+		opStrand.jump( opcode.getJump() );
+		COPPER_OPCODE_NEXT
 
-	case Opcode::ConditionalGoto:
+	COPPER_OPCODE_CASE(ConditionalGoto)
 #ifdef COPPER_OPCODE_DEBUGGING
 		print(LogLevel::debug, "[DEBUG: Execute opcode ConditionalGoto");
 #endif
@@ -5315,9 +6816,7 @@ Engine::operate(
 			if ( isBoolObject(*obj) ) {
 				// Use the inverse of the value because if-statements request jumps when condition is false
 				if ( ((BoolObject*)obj)->getValue() == false ) {
-					// Here we cheat and cast to volatile because we don't have a const iterator for the list
-					//opIter.set( ((const Opcode*)opcode)->getOpStrandIter() );
-					opIter.set( opcode->getOpStrandIter() );
+					opStrand.jump( opcode.getJump() );
 				}
 			} else {
 				//print(LogLevel::warning, "Condition for goto operation is not boolean. Default is false.");
@@ -5329,71 +6828,67 @@ Engine::operate(
 			print(LogLevel::error, EngineMessage::ConditionlessIf);
 			return ExecutionResult::Error;
 		}
-		break;
+		COPPER_OPCODE_NEXT
 
 	//------ Opcodes for handling structures that accept a single raw address
 
-	case Opcode::Own:
+	COPPER_OPCODE_CASE(Own)
 #ifdef COPPER_OPCODE_DEBUGGING
 		print(LogLevel::debug, "[DEBUG: Execute opcode Own");
 #endif
-		return run_Own( *(opcode->getAddressData()) );
+		return run_Own( *(strand->getAddressData(opcode)) );
 
-	case Opcode::Is_owner:
+	COPPER_OPCODE_CASE(Is_owner)
 #ifdef COPPER_OPCODE_DEBUGGING
 		print(LogLevel::debug, "[DEBUG: Execute opcode Is_owner");
 #endif
-		return run_Is_owner( *(opcode->getAddressData()) );
+		return run_Is_owner( *(strand->getAddressData(opcode)) );
 
-	case Opcode::Is_pointer:
+	COPPER_OPCODE_CASE(Is_pointer)
 #ifdef COPPER_OPCODE_DEBUGGING
 		print(LogLevel::debug, "[DEBUG: Execute opcode Is_pointer");
 #endif
-		return run_Is_ptr( *(opcode->getAddressData()) );
+		return run_Is_ptr( *(strand->getAddressData(opcode)) );
 
 	//------ Opcodes for creating basic types
 
-	case Opcode::CreateBoolTrue:
+	COPPER_OPCODE_CASE(CreateBoolTrue)
 #ifdef COPPER_OPCODE_DEBUGGING
 		print(LogLevel::debug, "[DEBUG: Execute opcode CreateBoolTrue");
 #endif
-		lastObject.setWithoutRef(new BoolObject(true));
-		break;
+		setLastObjectBool(true);
+		COPPER_OPCODE_NEXT
 
-	case Opcode::CreateBoolFalse:
+	COPPER_OPCODE_CASE(CreateBoolFalse)
 #ifdef COPPER_OPCODE_DEBUGGING
 		print(LogLevel::debug, "[DEBUG: Execute opcode CreateBoolFalse");
 #endif
-		lastObject.setWithoutRef(new BoolObject(false));
-		break;
+		setLastObjectBool(false);
+		COPPER_OPCODE_NEXT
 
-	case Opcode::CreateString:
+	COPPER_OPCODE_CASE(CreateString)
 #ifdef COPPER_OPCODE_DEBUGGING
 		print(LogLevel::debug, "[DEBUG: Execute opcode CreateString");
 #endif
 		// Should be creating strings from a user-set factory
 		lastObject.setWithoutRef(
-			new StringObject( opcode->getNameData() )
+			new StringObject( strand->getNameData(opcode) )
 		);
-		break;
+		COPPER_OPCODE_NEXT
 
-	case Opcode::CreateInteger:
+	COPPER_OPCODE_CASE(CreateInteger)
 #ifdef COPPER_OPCODE_DEBUGGING
 		print(LogLevel::debug, "[DEBUG: Execute opcode CreateInteger");
 #endif
-		lastObject.setWithoutRef(
-			new IntegerObject( opcode->getIntegerData() )
-		);
-		break;
+		lastObject.set( strand->getLiteral(opcode) );
+		COPPER_OPCODE_NEXT
 
-	case Opcode::CreateDecimal:
+	COPPER_OPCODE_CASE(CreateDecimal)
 #ifdef COPPER_OPCODE_DEBUGGING
 		print(LogLevel::debug, "[DEBUG: Execute opcode CreateInteger");
 #endif
-		lastObject.setWithoutRef(
-			new DecimalNumObject( opcode->getDecimalData() )
-		);
-		break;
+		lastObject.set( strand->getLiteral(opcode) );
+		COPPER_OPCODE_NEXT
 
 	default:
 		print(LogLevel::error, "Invalid opcode encountered.");
@@ -5403,6 +6898,9 @@ Engine::operate(
 	return ExecutionResult::Ok;
 }
 
+#undef COPPER_OPCODE_CASE
+#undef COPPER_OPCODE_NEXT
+
 //! Runs a given function with the passed parameters.
 // This is useful for callback functions.
 // Originally, it could not be safely run alongside Engine::run() or Engine::execute(), only after them.
@@ -5428,18 +6926,14 @@ Engine::runFunctionObject(
 
 	// Set default result value (required especially for empty functions)
 	//lastObject.setWithoutRef(new FunctionObject()); // <- REALLY SLOW!
-	lastObject.setWithoutRef(new NilObject());
+	setLastObjectNil();
 
 	// Parse function body if not done yet.
 	// If function body contained errors, return error.
 	// If function body has been / is parsed, add its opcodes to the stack.
+	// Functions without a body (such as data-only functions) have nothing to run.
 	Body* body;
-	if ( ! function->body.obtain(body) ) {
-		print(LogLevel::error, "(Error during Engine::runFunctionObject): Function body is missing.");
-		return EngineResult::Error;
-	}
-
-	if ( body->isEmpty() ) {
+	if ( ! function->body.obtain(body) || body->isEmpty() ) {
 		print(LogLevel::debug, "Engine::runFunctionObject: Function body is empty.");
 		return EngineResult::Ok;
 	}
@@ -5453,29 +6947,27 @@ Engine::runFunctionObject(
 
 	// TODO: Should be passed in as a name so that the user can identify the name
 	VarAddress* foreignAddr = new VarAddress();
-	foreignAddr->push_back("[FOREIGN FUNCTION]");
+	foreignAddr->push_back(Symbol("[FOREIGN FUNCTION]"));
 
 	// "this" pointer is added to new stack context if the body can be run.
-	StackFrame* stackFrame = new StackFrame(foreignAddr);
+	StackFrame& stackFrame = stack.push(foreignAddr, body->getLayout());
 	foreignAddr->deref();
 
 	// Add "this" pointer
 	Variable* callVariable;
-	stackFrame->getScope().getVariable(CONSTANT_FUNCTION_SELF, callVariable);
+	stackFrame.getVariable(SYMBOL_FUNCTION_SELF, callVariable);
 	callVariable->setFunc( functionObject, true );
 
 	// Argument-passing
 	if ( notNull(args) ) {
-		addForeignFunctionArgsToStackFrame(*stackFrame, function->params, *args);
+		addForeignFunctionArgsToStackFrame(stackFrame, function->params, *args);
 	}
 
-	// Add stack frame
-	stack.push(stackFrame);
-	stackFrame->deref();
 
 	// Create temporary strand stack
 	OpStrandStack  contextStrandStack;
-	contextStrandStack.push_back( OpStrandContainer(body->getOpcodeStrand(), true) );
+	const uint  argBase = sysCallArgs.size();
+	contextStrandStack.push_back( OpStrandContainer(body->getOpcodeStrand(), true, argBase) );
 
 	// Set the opcode strand stack used by the engine
 	activeOpcodeStrandStack = &contextStrandStack;
@@ -5485,6 +6977,9 @@ Engine::runFunctionObject(
 	// the currently running strand stack has been checked in execute().
 	EngineResult::Value  result = execute();
 
+	// Drop any arguments left by unfinished built-in calls
+	releaseSysCallArgs(argBase);
+
 	// Remove the frame just added
 	stack.pop();
 
@@ -5498,17 +6993,17 @@ Engine::runFunctionObject(
 void
 Engine::addForeignFunctionArgsToStackFrame(
 	StackFrame&  stackFrame,
-	const List<String>&  functionParams,
+	const List<Symbol>&  functionParams,
 	List<Object*>&  arguments
 ) {
-	List<String>::ConstIter  funcParamsIter = functionParams.constStart();
+	List<Symbol>::ConstIter  funcParamsIter = functionParams.constStart();
 	List<Object*>::Iter  givenArgsIter = arguments.start();
 	bool done = false;
 
 	if ( funcParamsIter.has() && givenArgsIter.has() ) {
 		do {
 			// Match parameters with parameter list items
-			stackFrame.getScope().setVariableFrom( *funcParamsIter, *givenArgsIter, true );
+			stackFrame.setVariableFrom( *funcParamsIter, *givenArgsIter, true );
 			if ( ! funcParamsIter.next() ) {
 				done = true;
 				break;
@@ -5530,14 +7025,15 @@ getLastObject() const {
 FuncExecReturn::Value
 Engine::setupFunctionExecution(
 	FuncFoundTask& task,
-	OpStrandStackIter&	opStrandStackIter
+	OpStrandStackIter&	opStrandStackIter,
+	bool	tailCall
 ) {
 #ifdef COPPER_DEBUG_ENGINE_MESSAGES
 	print(LogLevel::debug, "[DEBUG: Engine::setupFunctionExecution");
 #endif
 	// Protect from polution and allow for functions to have a default return.
 	//lastObject.setWithoutRef(new FunctionObject()); <- WAY TOO FREAKING SLOW
-	lastObject.setWithoutRef(new NilObject()); // Alittle slow because of dynamic allocation, but far faster than the above
+	setLastObjectNil(); // Shared instance, so nothing is allocated
 	FuncExecReturn::Value result;
 
 	if ( ! task.getAddress().has() )
@@ -5553,7 +7049,107 @@ Engine::setupFunctionExecution(
 		return result;
 	}
 
-	return setupUserFunctionExecution(task, opStrandStackIter);
+	return setupUserFunctionExecution(task, opStrandStackIter, tailCall);
+}
+
+// Gives the same results as the process_sys_ functions for the built-in functions accepted
+// by fuseConditionCall(). As with SysCall, null arguments are skipped.
+bool
+Engine::testCondition(
+	SystemFunction::Value	pFunction,
+	uint					pArgStart,
+	bool&					pResult
+) {
+	const uint  argEnd = sysCallArgs.size();
+	uint  a = pArgStart;
+	Object*  arg;
+	Object*  first = REAL_NULL;
+	bool  passed;
+
+	switch( pFunction ) {
+	case SystemFunction::_not:
+		pResult = true;
+		for (; a < argEnd; ++a) {
+			if ( notNull(sysCallArgs.get(a)) ) {
+				pResult = ! getBoolValue( *(sysCallArgs.get(a)) );
+				break;
+			}
+		}
+		return true;
+
+	case SystemFunction::_all:
+	case SystemFunction::_any:
+		// Stops at the first value that decides the result
+		pResult = false;
+		for (; a < argEnd; ++a) {
+			if ( isNull(sysCallArgs.get(a)) )
+				continue;
+			pResult = getBoolValue( *(sysCallArgs.get(a)) );
+			if ( pResult == (pFunction == SystemFunction::_any) )
+				break;
+		}
+		return true;
+
+	case SystemFunction::_string_match:
+		pResult = true;
+		for (; a < argEnd; ++a) {
+			arg = sysCallArgs.get(a);
+			if ( isNull(arg) )
+				continue;
+			if ( ! isStringObject(*arg) )
+				return false;
+			if ( isNull(first) ) {
+				first = arg;
+			} else if ( ! ((StringObject*)first)->getString().equals( ((StringObject*)arg)->getString() ) ) {
+				pResult = false;
+				break;
+			}
+		}
+		return true;
+
+	case SystemFunction::_num_equal:
+	case SystemFunction::_num_greater_than:
+	case SystemFunction::_num_greater_or_equal:
+	case SystemFunction::_num_less_than:
+	case SystemFunction::_num_less_or_equal:
+		pResult = true;
+		for (; a < argEnd; ++a) {
+			arg = sysCallArgs.get(a);
+			if ( isNull(arg) )
+				continue;
+			if ( ! isNumericObject(*arg) )
+				return false;
+			if ( isNull(first) ) {
+				first = arg;
+				continue;
+			}
+			switch( pFunction ) {
+			case SystemFunction::_num_equal:
+				passed = ((NumericObject*)first)->isEqualTo( *((NumericObject*)arg) );
+				break;
+			case SystemFunction::_num_greater_than:
+				passed = ((NumericObject*)first)->isGreaterThan( *((NumericObject*)arg) );
+				break;
+			case SystemFunction::_num_greater_or_equal:
+				passed = ((NumericObject*)first)->isGreaterOrEqual( *((NumericObject*)arg) );
+				break;
+			case SystemFunction::_num_less_than:
+				passed = ! ((NumericObject*)first)->isGreaterOrEqual( *((NumericObject*)arg) );
+				break;
+			default: // _num_less_or_equal
+				passed = ! ((NumericObject*)first)->isGreaterThan( *((NumericObject*)arg) );
+				break;
+			}
+			if ( ! passed ) {
+				pResult = false;
+				break;
+			}
+		}
+		return true;
+
+	default:
+		return false;
+	}
 }
 
 FuncExecReturn::Value
@@ -5571,12 +7167,12 @@ Engine::setupBuiltinFunctionExecution(
 	// Based on time tests, the first one. Using a switch is basically a manual lookup-table.
 
 	//VarAddressConstIter addrIter = task.getAddress().constStart();
-	//RobinHoodHash<SystemFunction::Value>::BucketData* bucketData
+	//RobinHoodHash<SystemFunction::Value, Symbol>::BucketData* bucketData
 	//	= builtinFunctions.getBucketData(*addrIter);
 
 	// This code is being optimized out.
 /*
-	RobinHoodHash<SystemFunction::Value>::BucketData* bucketData
+	RobinHoodHash<SystemFunction::Value, Symbol>::BucketData* bucketData
 		= builtinFunctions.getBucketData(task.getAddress().first());
 
 	// No matching function found
@@ -5835,16 +7431,23 @@ Engine::setupForeignFunctionExecution(
 	print(LogLevel::debug, "[DEBUG: Engine::setupForeignFunctionExecution");
 #endif
 
-	RobinHoodHash<ForeignFuncContainer>::BucketData* bucketData
-		= foreignFunctions.getBucketData(task.getAddress().first());
+	ForeignFunc* foreignFunc = REAL_NULL;
 
-	if ( ! bucketData ) {
-		return FuncExecReturn::NoMatch;
+	if ( task.getAddress().hasOne() ) {
+		// Optimization: Use the lookup cached in the address
+		foreignFunc = findForeignFunction(task.getAddress());
+	} else {
+		RobinHoodHash<ForeignFuncContainer, Symbol>::BucketData* bucketData
+			= foreignFunctions.getBucketData(task.getAddress().first());
+		if ( bucketData )
+			foreignFunc = bucketData->item.getForeignFunction();
 	}
 
-	ForeignFunc* foreignFunc = bucketData->item.getForeignFunction();
+	if ( isNull(foreignFunc) ) {
+		return FuncExecReturn::NoMatch;
+	}
 
-	FFIServices ffi(*this, task.args, task.getAddress().first());
+	FFIServices ffi(*this, task.args, task.getAddress().first().getName());
 	ForeignFunc::Result  result = foreignFunc->call( ffi );
 
 	// lastObject is set by setResult() or setNewResult() of the FFI.
@@ -5869,7 +7472,8 @@ Engine::setupForeignFunctionExecution(
 FuncExecReturn::Value
 Engine::setupUserFunctionExecution(
 	FuncFoundTask& task,
-	OpStrandStackIter&	opStrandStackIter
+	OpStrandStackIter&	opStrandStackIter,
+	bool	tailCall
 ) {
 #ifdef COPPER_DEBUG_ENGINE_MESSAGES
 	print(LogLevel::debug, "[DEBUG: Engine::setupUserFunctionExecution");
@@ -5909,32 +7513,28 @@ Engine::setupUserFunctionExecution(
 
 	Variable* callVariable = REAL_NULL;
 	Variable* super = REAL_NULL;
-	Scope* scope = &getCurrentTopScope();
 	Function* func = REAL_NULL;
 	bool foundVar = false;
+	bool localVar = false; // The called function (and "super") belong to the frame of the caller
 
 	VarAddress::Iterator ai = task.getAddress().iterator();
-	if ( scope->findVariable(ai.get(), callVariable) ) {
+	if ( stack.getTop().findVariable(task.getAddress(), callVariable) ) {
 		foundVar = true;
+		localVar = true;
 		while ( ai.next() ) {
 			super = callVariable;
-			func = callVariable->getFunction(logger);
-			scope = &(func->getPersistentScope());
-			scope->getVariable(ai.get(), callVariable);
+			callVariable = getMemberVariable(ai, callVariable);
 		}
 		func = callVariable->getFunction(logger);
 	}
 
 	if ( !foundVar ) {
 		ai.reset();
-		scope = &getGlobalScope();
-		if ( scope->findVariable(ai.get(), callVariable) ) {
+		if ( findGlobalVariable(task.getAddress(), callVariable) ) {
 			foundVar = true;
 			while( ai.next() ) {
 				super = callVariable;
-				func = callVariable->getFunction(logger);
-				scope = &(func->getPersistentScope());
-				scope->getVariable(ai.get(), callVariable);
+				callVariable = getMemberVariable(ai, callVariable);
 			}
 			func = callVariable->getFunction(logger);
 		}
@@ -5942,13 +7542,11 @@ Engine::setupUserFunctionExecution(
 
 	if ( !foundVar ) {
 		ai.reset();
-		scope = &getCurrentTopScope();
-		scope->getVariable(ai.get(), callVariable); // Create the base variable since it does not exist
+		localVar = true;
+		stack.getTop().getVariable(task.getAddress(), callVariable); // Create the base variable since it does not exist
 		while ( ai.next() ) {
 			super = callVariable;
-			func = callVariable->getFunction(logger);
-			scope = &(func->getPersistentScope());
-			scope->getVariable(ai.get(), callVariable);
+			callVariable = getMemberVariable(ai, callVariable);
 		}
 		func = callVariable->getFunction(logger);
 	}
@@ -5969,13 +7567,9 @@ Engine::setupUserFunctionExecution(
 	// Parse function body if not done yet.
 	// If function body contained errors, return error.
 	// If function body has been / is parsed, add its opcodes to the stack.
+	// Functions without a body (such as data-only functions) have nothing to run.
 	Body* body;
-	if ( ! func->body.obtain(body) ) {
-		print(LogLevel::error, "SYSTEM ERROR: Function body is missing.");
-		return FuncExecReturn::ErrorOnRun;
-	}
-
-	if ( body->isEmpty() ) {
+	if ( ! func->body.obtain(body) || body->isEmpty() ) {
 		return FuncExecReturn::Ran;
 	}
 
@@ -5986,27 +7580,51 @@ Engine::setupUserFunctionExecution(
 		return FuncExecReturn::ErrorOnRun;
 	}
 
+	// A tail call replaces the frame and strand of the function making it, so recursion
+	// in tail position runs in constant space. The global strand (or the body of a function
+	// run by runFunctionObject()) is at the start of the strand stack and is never replaced.
+	// "this", "super", and function arguments are pointers, which do not keep the functions they
+	// point to alive. When the called function (and so "super") belongs to the frame being removed,
+	// or when an argument is an owned function (which may belong to that frame directly or as a
+	// member), removing the frame would destroy them, so such calls run normally.
+	bool  replaceCaller = tailCall && ! opStrandStackIter.atStart() && ! localVar;
+	if ( replaceCaller ) {
+		ArgsBuffer::Iter  argsIter = task.args.start();
+		if ( argsIter.has() )
+		do {
+			if ( isFunctionObject(**argsIter) && ((FunctionObject*)*argsIter)->isOwned() ) {
+				replaceCaller = false;
+				break;
+			}
+		} while ( argsIter.next() );
+	}
+	if ( replaceCaller ) {
+		releaseSysCallArgs( (*opStrandStackIter).getArgBase() );
+		stack.pop();
+		activeOpcodeStrandStack->pop();
+	}
+
 	// "super" and "this" are added to new stack context if the body can be run.
-	StackFrame* stackFrame = new StackFrame(task.varAddress);
+	StackFrame& stackFrame = stack.push(task.varAddress, body->getLayout());
 
 	if ( notNull(super) ) {
 		// Add "super" pointer
-		stackFrame->getScope().setVariable(CONSTANT_FUNCTION_SUPER, super, true);
+		stackFrame.setVariable(SYMBOL_FUNCTION_SUPER, super, true);
 	}
 
 	// Add "this" pointer
-	stackFrame->getScope().setVariable(CONSTANT_FUNCTION_SELF, callVariable, true);
+	stackFrame.setVariable(SYMBOL_FUNCTION_SELF, callVariable, true);
 
 	// For each parameter that the function requires, take from the passed parameters and
 	// assign it by pointer to a parameter name within the newly added scope.
-	ArgsIter givenArgsIter = task.args.start();
-	List<String>::Iter funcParamsIter = func->params.start();
+	ArgsBuffer::Iter givenArgsIter = task.args.start();
+	List<Symbol>::Iter funcParamsIter = func->params.start();
 	bool done = false;
 	if ( funcParamsIter.has() ) {
 		if ( givenArgsIter.has() )
 		do {
 			// Match parameters with parameter list items
-			stackFrame->getScope().setVariableFrom( *funcParamsIter, *givenArgsIter, true );
+			stackFrame.setVariableFrom( *funcParamsIter, *givenArgsIter, true );
 			if ( ! funcParamsIter.next() ) {
 				done = true;
 				break;
@@ -6016,14 +7634,12 @@ Engine::setupUserFunctionExecution(
 		do {
 			print( LogLevel::warning, EngineMessage::MissingFunctionCallArg );
 			// Default remaining parameters to empty function.
-			stackFrame->getScope().addVariable( *funcParamsIter );
+			stackFrame.addVariable( *funcParamsIter );
 		} while ( funcParamsIter.next() );
 	}
 	// TODO: Leftover task arguments may eventually be stored in a splat variable or included as part
 	// of an all-inclusive "arguments" list.
 
-	stack.push(stackFrame);
-	stackFrame->deref();
 
 	// Unfortunately, incrementing up a stack frame leaves the current operator at a used token.
 	// We don't want this, so handle it in execute().
@@ -6031,6 +7647,10 @@ Engine::setupUserFunctionExecution(
 	// Finally, add the body to be processed
 	addOpStrandToStack(body->getOpcodeStrand());
 
+	if ( replaceCaller ) {
+		opStrandStackIter.makeLast();
+		return FuncExecReturn::Reset;
+	}
 	opStrandStackIter.next();
 	//opStrandStackIter.makeLast();
 	// Since the iterator in the OpStrand container is separately defined from the list, there is no
@@ -6039,6 +7659,19 @@ Engine::setupUserFunctionExecution(
 	return FuncExecReturn::Reset;
 }
 
+ForeignFunc*
+Engine::findForeignFunction(
+	const VarAddress& address
+) {
+	if ( address.foreignFuncStamp != foreignFunctionsStamp ) {
+		RobinHoodHash<ForeignFuncContainer, Symbol>::BucketData* bucketData
+			= foreignFunctions.getBucketData( address.getFullName() );
+		address.foreignFunc = ( bucketData ? bucketData->item.getForeignFunction() : REAL_NULL );
+		address.foreignFuncStamp = foreignFunctionsStamp;
+	}
+	return address.foreignFunc;
+}
+
 Variable*
 Engine::resolveVariableAddress(
 	const VarAddress& address
@@ -6062,7 +7695,7 @@ Engine::resolveVariableAddress(
 	
 	// Original code that seems to be a second or two faster than the new code. Why?
 /*
-	RobinHoodHash<SystemFunction::Value>::BucketData* sfBucket
+	RobinHoodHash<SystemFunction::Value, Symbol>::BucketData* sfBucket
 		= builtinFunctions.getBucketData( address.first() );
 	if ( sfBucket != 0 ) { // Error, but handling is determined by the method that calls this one
 		//print(LogLevel::warning, "Attempt to use standard access on a built-in function.");
@@ -6077,55 +7710,223 @@ Engine::resolveVariableAddress(
 		return REAL_NULL;
 	}
 
-	RobinHoodHash<ForeignFuncContainer>::BucketData* ffBucket
-		= foreignFunctions.getBucketData( addressToString(address) );
-	if ( ffBucket != 0 ) { // Error, but handling is determined by the method that calls this one
+	if ( notNull(findForeignFunction(address)) ) { // Error, but handling is determined by the method that calls this one
 		//print(LogLevel::warning, "Attempt to use standard access on a foreign function.");
 		print(LogLevel::warning, EngineMessage::ForeignFuncInvalidAccess);
 		return REAL_NULL;
 	}
 
-	Scope* scope = &getCurrentTopScope();
 	Variable* var = REAL_NULL;
-	Function* func = REAL_NULL;
 	VarAddress::Iterator ai = address.iterator();
 
 	// Search locals
-	if ( scope->findVariable(ai.get(), var) ) {
+	if ( stack.getTop().findVariable(address, var) ) {
 		while( ai.next() ) {
-			func = var->getFunction(logger);
-			scope = &(func->getPersistentScope());		
-			scope->getVariable(ai.get(), var);	
+			var = getMemberVariable(ai, var);
 		}
 		return var;
 	}
 
 	// Search globals
-	scope = &getGlobalScope();
 	ai.reset();
-	if ( scope->findVariable(ai.get(), var) ) {
+	if ( findGlobalVariable(address, var) ) {
 		while( ai.next() ) {
-			func = var->getFunction(logger);
-			scope = &(func->getPersistentScope());		
-			scope->getVariable(ai.get(), var);	
+			var = getMemberVariable(ai, var);
 		}
 		return var;
 	}
 
 	// No base variable found, so just create it as a local
-	scope = &getCurrentTopScope();
 	ai.reset();
-	while(true) {
-		scope->getVariable(ai.get(), var);
-		if ( !ai.next() ) {
-			break;
-		}
-		func = var->getFunction(logger);
-		scope = &(func->getPersistentScope());
+	stack.getTop().getVariable(address, var);
+	while ( ai.next() ) {
+		var = getMemberVariable(ai, var);
+	}
+	return var;
+}
+
+Variable*
+Engine::getMemberVariable(
+	VarAddress::Iterator&	ai,
+	Variable*				var
+) {
+	// getFunction() is always called since it may reset the variable.
+	Scope& scope = var->getFunction(logger)->getPersistentScope();
+	Variable* member = ai.getCachedVariable( scope.getStamp() );
+	if ( notNull(member) ) {
+		++memberCacheHits;
+		return member;
+	}
+	++memberCacheMisses;
+	scope.getVariable(ai.get(), member);
+	// The stamp changes if the member had to be created
+	ai.setCachedVariable( member, scope.getStamp() );
+	return member;
+}
+
+bool
+Engine::findGlobalVariable(
+	const VarAddress&	address,
+	Variable*&			var
+) {
+	Scope& globals = getGlobalScope();
+	var = address.getCachedGlobal( globals.getStamp() );
+	if ( notNull(var) )
+		return true;
+	if ( globals.findVariable(address.first(), var) ) {
+		address.setCachedGlobal( var, globals.getStamp() );
+		return true;
+	}
+	return false;
+}
+
+#ifdef COPPER_ENABLE_QUICKENING
+// The checks repeat those of resolveVariableAddress() that could give a different result:
+// A foreign function may have been added, and the variable of the slot may have been set or not.
+Variable*
+Engine::findQuickenedVariable(
+	Opcode::Type		type,
+	const VarAddress&	address
+) {
+	if ( address.foreignFuncStamp != foreignFunctionsStamp )
+		return REAL_NULL;
+
+	Variable** slot = stack.getTop().getSlot(address);
+	Variable* var;
+	if ( type == Opcode::FuncFound_accessLocal ) {
+		if ( isNull(slot) || isNull(*slot) )
+			return REAL_NULL;
+		var = *slot;
+	} else {
+		// The local search must fail. Names without slots are only searched for globally at the global frame.
+		if ( notNull(slot) ? notNull(*slot) : ! stack.isTopGlobal() )
+			return REAL_NULL;
+		if ( ! findGlobalVariable(address, var) )
+			return REAL_NULL;
+	}
+	VarAddress::Iterator ai = address.iterator();
+	while ( ai.next() ) {
+		var = getMemberVariable(ai, var);
+	}
+	return var;
+}
+
+// Called after resolveVariableAddress(), which has created the variable if needed.
+void
+Engine::quickenAccess(
+	OpStrandContainer&	opStrand,
+	const VarAddress&	address
+) {
+	Opcode::Type type = Opcode::FuncFound_access;
+	Variable** slot;
+	if ( address.sysFuncValue == SystemFunction::_unset
+		&& address.foreignFuncStamp == foreignFunctionsStamp && isNull(address.foreignFunc) )
+	{
+		slot = stack.getTop().getSlot(address);
+		if ( notNull(slot) && notNull(*slot) )
+			type = Opcode::FuncFound_accessLocal;
+		else if ( notNull(slot) || stack.isTopGlobal() )
+			type = Opcode::FuncFound_accessGlobal;
+	}
+	if ( opStrand.getCurrOp().getType() != type )
+		opStrand.getCurrStrand()->setType( opStrand.getIndex(), type );
+}
+
+// As in setupUserFunctionExecution(), except that variables are not created
+Variable*
+Engine::findDirectCallVariable(
+	const VarAddress&	address
+) {
+	if ( address.foreignFuncStamp != foreignFunctionsStamp )
+		return REAL_NULL;
+
+	Variable* var;
+	if ( stack.isTopGlobal() ) {
+		// The local scope is the global scope
+		if ( ! findGlobalVariable(address, var) )
+			return REAL_NULL;
+	}
+	else if ( ! stack.getTop().findVariable(address, var) && ! findGlobalVariable(address, var) ) {
+		return REAL_NULL;
+	}
+	VarAddress::Iterator ai = address.iterator();
+	while ( ai.next() ) {
+		var = getMemberVariable(ai, var);
 	}
 	return var;
 }
 
+void
+Engine::quickenFoundCall(
+	OpStrandContainer&	opStrand,
+	const VarAddress&	address
+) {
+	const OpStrand&  strand = *( opStrand.getCurrStrand() );
+	const uint  next = opStrand.getIndex() + 1;
+	if ( opStrand.getCurrOp().getType() != Opcode::FuncFound_call || next >= strand.size() )
+		return;
+
+	switch( strand.get(next).getType() ) {
+	case Opcode::FuncFound_finishCall:
+	case Opcode::FuncFound_finishTailCall:
+	case Opcode::FuncFound_finishUserCall:
+	case Opcode::FuncFound_finishUserTailCall:
+		break;
+	default:
+		return; // Has arguments
+	}
+	if ( address.sysFuncValue == SystemFunction::_unset && address.hasOne()
+		&& isNull( findForeignFunction(address) ) )
+	{
+		opStrand.getCurrStrand()->setType( opStrand.getIndex(), Opcode::FuncFound_callDirect );
+	}
+}
+
+// Only calls by one name are quickened because a foreign function is looked up by the full name
+// (see setupForeignFunctionExecution()).
+bool
+Engine::quickenCall(
+	OpStrandContainer&	opStrand,
+	const VarAddress&	address
+) {
+	const Opcode::Type current = opStrand.getCurrOp().getType();
+	bool tailCall = false;
+	bool userCall;
+
+	switch( current ) {
+	case Opcode::FuncFound_finishUserCall:
+	case Opcode::FuncFound_finishUserTailCall:
+		if ( address.foreignFuncStamp == foreignFunctionsStamp )
+			return true;
+		break;
+	default:
+		break;
+	}
+
+	switch( current ) {
+	case Opcode::FuncFound_finishTailCall:
+	case Opcode::FuncFound_finishUserTailCall:
+		tailCall = true;
+		break;
+	default:
+		break;
+	}
+
+	userCall = address.sysFuncValue == SystemFunction::_unset && address.hasOne()
+		&& isNull( findForeignFunction(address) );
+
+	Opcode::Type type;
+	if ( userCall )
+		type = tailCall ? Opcode::FuncFound_finishUserTailCall : Opcode::FuncFound_finishUserCall;
+	else
+		type = tailCall ? Opcode::FuncFound_finishTailCall : Opcode::FuncFound_finishCall;
+
+	if ( current != type )
+		opStrand.getCurrStrand()->setType( opStrand.getIndex(), type );
+	return userCall;
+}
+#endif
+
 ExecutionResult::Value
 Engine::run_Own(
 	const VarAddress& address
@@ -6133,7 +7934,7 @@ Engine::run_Own(
 #ifdef COPPER_DEBUG_ENGINE_MESSAGES
 	print(LogLevel::debug, "[DEBUG: Engine::run_Own");
 #endif
-	lastObject.setWithoutRef(new NilObject()); // was new FunctionObject but that's pointless
+	setLastObjectNil(); // was new FunctionObject but that's pointless
 	if ( !ownershipChangingEnabled ) {
 		//print(LogLevel::warning, "Ownership changing is disabled.");
 		print(LogLevel::warning, EngineMessage::PointerNewOwnershipDisabled);
@@ -6172,9 +7973,7 @@ Engine::run_Is_owner(
 #ifdef COPPER_DEBUG_ENGINE_MESSAGES
 	print(LogLevel::debug, "[DEBUG: Engine::run_Is_owner");
 #endif
-	lastObject.setWithoutRef(new BoolObject(
-		! is_var_pointer( address )
-	));
+	setLastObjectBool( ! is_var_pointer( address ) );
 	return ExecutionResult::Ok;
 }
 
@@ -6185,9 +7984,7 @@ Engine::run_Is_ptr(
 #ifdef COPPER_DEBUG_ENGINE_MESSAGES
 	print(LogLevel::debug, "[DEBUG: Engine::run_Is_ptr");
 #endif
-	lastObject.setWithoutRef(new BoolObject(
-		is_var_pointer( address )
-	));
+	setLastObjectBool( is_var_pointer( address ) );
 	return ExecutionResult::Ok;
 }
 
@@ -6246,14 +8043,19 @@ Engine::process_sys_are_available(
 #endif
 	bool result = true;
 	String argValue;
+	Symbol argSymbol;
+	const ReservedName* reservedName;
 	Integer argIndex = 1;
-	ArgsIter argsIter = task.args.start();
+	ArgsBuffer::Iter argsIter = task.args.start();
 	if ( argsIter.has() )
 	do {
 		if ( isStringObject(**argsIter) ) {
 			argValue = ((StringObject*)(*argsIter))->getString();
-			result = builtinFunctions.getBucketData(argValue) != 0
-					|| foreignFunctions.getBucketData(argValue) != 0;
+			reservedName = Symbol::fromId(
+					SymbolTable::get().find( StringSpan(argValue.c_str(), argValue.size()) )
+				).getReservedName();
+			result = ( reservedName && reservedName->kind == ReservedName::Builtin )
+					|| ( Symbol::find(argValue, argSymbol) && foreignFunctions.getBucketData(argSymbol) != 0 );
 		} else {
 			print( LogMessage::create(LogLevel::warning)
 				.SystemFunctionId( SystemFunction::_are_available )
@@ -6265,7 +8067,7 @@ Engine::process_sys_are_available(
 		}
 		++argIndex;
 	} while ( argsIter.next() && result );
-	lastObject.setWithoutRef(new BoolObject(result));
+	setLastObjectBool(result);
 	return FuncExecReturn::Ran;	
 }
 
@@ -6277,11 +8079,11 @@ Engine::process_sys_not(
 	print(LogLevel::debug, "[DEBUG: Engine::process_sys_not");
 #endif
 	bool result = true;
-	ArgsIter ai = task.args.start();
+	ArgsBuffer::Iter ai = task.args.start();
 	if ( ai.has() ) {
 		result = ! getBoolValue(**ai);
 	}
-	lastObject.setWithoutRef(new BoolObject(result));
+	setLastObjectBool(result);
 	return FuncExecReturn::Ran;
 }
 
@@ -6293,12 +8095,12 @@ Engine::process_sys_all(
 	print(LogLevel::debug, "[DEBUG: Engine::process_sys_all");
 #endif
 	bool result = false;
-	ArgsIter ai = task.args.start();
+	ArgsBuffer::Iter ai = task.args.start();
 	if ( ai.has() )
 	do {
 		result = getBoolValue(**ai);
 	} while ( ai.next() && result );
-	lastObject.setWithoutRef(new BoolObject(result));
+	setLastObjectBool(result);
 	return FuncExecReturn::Ran;
 }
 
@@ -6310,12 +8112,12 @@ Engine::process_sys_any(
 	print(LogLevel::debug, "[DEBUG: Engine::process_sys_any");
 #endif
 	bool result = false;
-	ArgsIter ai = task.args.start();
+	ArgsBuffer::Iter ai = task.args.start();
 	if ( ai.has() )
 	do {
 		result = getBoolValue(**ai);
 	} while ( ai.next() && ! result );
-	lastObject.setWithoutRef(new BoolObject(result));
+	setLastObjectBool(result);
 	return FuncExecReturn::Ran;
 }
 
@@ -6327,12 +8129,12 @@ Engine::process_sys_nall(
 	print(LogLevel::debug, "[DEBUG: Engine::process_sys_nall");
 #endif
 	bool result = true;
-	ArgsIter ai = task.args.start();
+	ArgsBuffer::Iter ai = task.args.start();
 	if ( ai.has() )
 	do {
 		result = ! getBoolValue(**ai);
 	} while ( ai.next() && !result );
-	lastObject.setWithoutRef(new BoolObject(result));
+	setLastObjectBool(result);
 	return FuncExecReturn::Ran;
 }
 
@@ -6344,12 +8146,12 @@ Engine::process_sys_none(
 	print(LogLevel::debug, "[DEBUG: Engine::process_sys_none");
 #endif
 	bool result = true;
-	ArgsIter ai = task.args.start();
+	ArgsBuffer::Iter ai = task.args.start();
 	if ( ai.has() )
 	do {
 		result = ! getBoolValue(**ai);
 	} while ( ai.next() && !result );
-	lastObject.setWithoutRef(new BoolObject(result));
+	setLastObjectBool(result);
 	return FuncExecReturn::Ran;
 }
 
@@ -6362,14 +8164,14 @@ Engine::process_sys_xall(
 #endif
 	bool first = false;
 	bool sameness = true;
-	ArgsIter ai = task.args.start();
+	ArgsBuffer::Iter ai = task.args.start();
 	if ( ai.has() ) {
 		first = getBoolValue(**ai);
 		while ( ai.next() && sameness ) {
 			sameness = first == getBoolValue(**ai);
 		}
 	}
-	lastObject.setWithoutRef(new BoolObject(sameness));
+	setLastObjectBool(sameness);
 	return FuncExecReturn::Ran;
 }
 
@@ -6381,12 +8183,12 @@ Engine::process_sys_are_fn(
 	print(LogLevel::debug, "[DEBUG: Engine::process_sys_are_fn");
 #endif
 	bool result = false;
-	ArgsIter ai = task.args.start();
+	ArgsBuffer::Iter ai = task.args.start();
 	if ( ai.has() )
 	do {
 		result = isFunctionObject(**ai);
 	} while ( ai.next() && !result );
-	lastObject.setWithoutRef(new BoolObject(result));
+	setLastObjectBool(result);
 	return FuncExecReturn::Ran;
 }
 
@@ -6398,12 +8200,12 @@ Engine::process_sys_are_empty(
 	print(LogLevel::debug, "[DEBUG: Engine::process_sys_are_empty");
 #endif
 	bool result = false;
-	ArgsIter ai = task.args.start();
+	ArgsBuffer::Iter ai = task.args.start();
 	if ( ai.has() )
 	do {
 		result = isEmptyFunctionObject(**ai);
 	} while ( ai.next() && result );
-	lastObject.setWithoutRef(new BoolObject(result));
+	setLastObjectBool(result);
 	return FuncExecReturn::Ran;
 }
 
@@ -6418,14 +8220,14 @@ Engine::process_sys_are_same(
 	// to the same function, but as data is copied by default anyways, it won't matter.
 	bool result = true;
 	Object* firstPtr = REAL_NULL;
-	ArgsIter ai = task.args.start();
+	ArgsBuffer::Iter ai = task.args.start();
 	if ( ai.has() ) {
 		firstPtr = *ai;
 		while( ai.next() && result ) {
 			result = ( firstPtr == *ai );
 		}
 	}
-	lastObject.setWithoutRef(new BoolObject(result));
+	setLastObjectBool(result);
 	return FuncExecReturn::Ran;
 }
 
@@ -6437,7 +8239,7 @@ Engine::process_sys_member(
 #ifdef COPPER_DEBUG_ENGINE_MESSAGES
 	print(LogLevel::debug, "[DEBUG: Engine::process_sys_member");
 #endif
-	ArgsIter argsIter = task.args.start();
+	ArgsBuffer::Iter argsIter = task.args.start();
 	if ( task.args.size() != 2 ) {
 		printSystemFunctionWrongArgCount( SystemFunction::_member, task.args.size(), 2 );
 		return FuncExecReturn::ErrorOnRun;
@@ -6479,7 +8281,10 @@ Engine::process_sys_member(
 		return FuncExecReturn::ErrorOnRun;
 	}
 	Variable* var;
-	parentFunc->getPersistentScope().getVariable( rawStr, var );
+	// The name is only interned when the member must be created
+	if ( ! parentFunc->getPersistentScope().findVariable( rawStr, var ) ) {
+		parentFunc->getPersistentScope().getVariable( Symbol(rawStr), var );
+	}
 	lastObject.set( var->getRawContainer() );
 	return FuncExecReturn::Ran;
 }
@@ -6492,7 +8297,7 @@ Engine::process_sys_member_count(
 #ifdef COPPER_DEBUG_ENGINE_MESSAGES
 	print(LogLevel::debug, "[DEBUG: Engine::process_sys_member_count");
 #endif
-	ArgsIter argsIter = task.args.start();
+	ArgsBuffer::Iter argsIter = task.args.start();
 	if ( task.args.size() != 1 ) {
 		printSystemFunctionWrongArgCount( SystemFunction::_member_count, task.args.size(), 1 );
 		lastObject.setWithoutRef(new IntegerObject(0));
@@ -6517,7 +8322,9 @@ Engine::process_sys_member_count(
 		);
 		return FuncExecReturn::ErrorOnRun;
 	}
-	unsigned long size = parentFunc->getPersistentScope().occupancy();
+	unsigned long size = 0;
+	if ( parentFunc->hasPersistentScope() )
+		size = parentFunc->getPersistentScope().occupancy();
 	lastObject.setWithoutRef(new IntegerObject(Integer(size)));
 
 	return FuncExecReturn::Ran;
@@ -6531,10 +8338,10 @@ Engine::process_sys_is_member(
 #ifdef COPPER_DEBUG_ENGINE_MESSAGES
 	print(LogLevel::debug, "[DEBUG: Engine::process_sys_is_member");
 #endif
-	ArgsIter argsIter = task.args.start();
+	ArgsBuffer::Iter argsIter = task.args.start();
 	if ( task.args.size() != 2 ) {
 		printSystemFunctionWrongArgCount( SystemFunction::_is_member, task.args.size(), 2 );
-		lastObject.setWithoutRef(new BoolObject(false));
+		setLastObjectBool(false);
 		return FuncExecReturn::ErrorOnRun;
 	}
 	// First parameter is the parent function of the members
@@ -6566,8 +8373,9 @@ Engine::process_sys_is_member(
 		return FuncExecReturn::ErrorOnRun;
 	}
 	const String& memberName = ((StringObject*)*argsIter)->getString();
-	result = parentFunc->getPersistentScope().variableExists( memberName );
-	lastObject.setWithoutRef(new BoolObject(result));
+	result = parentFunc->hasPersistentScope()
+		&& parentFunc->getPersistentScope().variableExists( memberName );
+	setLastObjectBool(result);
 	return FuncExecReturn::Ran;
 }
 
@@ -6579,7 +8387,7 @@ Engine::process_sys_set_member(
 #ifdef COPPER_DEBUG_ENGINE_MESSAGES
 	print(LogLevel::debug, "[DEBUG: Engine::process_sys_set_member");
 #endif
-	ArgsIter argsIter = task.args.start();
+	ArgsBuffer::Iter argsIter = task.args.start();
 	if ( task.args.size() != 3 ) {
 		printSystemFunctionWrongArgCount( SystemFunction::_set_member, task.args.size(), 3 );
 
@@ -6627,7 +8435,8 @@ Engine::process_sys_set_member(
 	}
 	// Third parameter can be anything
 	argsIter.next();
-	parentFunc->getPersistentScope().setVariableFrom( memberName, *argsIter, false );
+	// Setting may create the member, so the name is interned here (and only here)
+	parentFunc->getPersistentScope().setVariableFrom( Symbol(memberName), *argsIter, false );
 	//lastObject.setWithoutRef(new NilObject()); // was new FunctionObject. Unnecessary.
 	return FuncExecReturn::Ran;
 }
@@ -6639,7 +8448,7 @@ Engine::process_sys_member_list(
 #ifdef COPPER_DEBUG_ENGINE_MESSAGES
 	print(LogLevel::debug, "[DEBUG: Engine::process_sys_member_list");
 #endif
-	ArgsIter  argsIter = task.args.start();
+	ArgsBuffer::Iter  argsIter = task.args.start();
 	if ( !argsIter.has() ) {
 		// Nothing to do here
 		lastObject.setWithoutRef(new ListObject());
@@ -6654,7 +8463,8 @@ Engine::process_sys_member_list(
 		if ( isFunctionObject(**argsIter) ) {
 			usableFC = (FunctionObject*)(*argsIter);
 			if ( usableFC->getFunction(usableFunc) ) {
-				usableFunc->getPersistentScope().appendNamesByInterface(outList);
+				if ( usableFunc->hasPersistentScope() )
+					usableFunc->getPersistentScope().appendNamesByInterface(outList);
 			} else {
 				print( LogMessage::create(LogLevel::warning)
 					.SystemFunctionId( SystemFunction::_member_list )
@@ -6679,7 +8489,7 @@ Engine::process_sys_union(
 #ifdef COPPER_DEBUG_ENGINE_MESSAGES
 	print(LogLevel::debug, "[DEBUG: Engine::process_sys_union");
 #endif
-	ArgsIter  argsIter = task.args.start();
+	ArgsBuffer::Iter  argsIter = task.args.start();
 	if ( !argsIter.has() ) {
 		print(LogLevel::info, "union function called without parameters. Default return is empty function.");
 		lastObject.setWithoutRef(new FunctionObject()); // I want the default return of union to be empty function
@@ -6695,7 +8505,8 @@ Engine::process_sys_union(
 		if ( isFunctionObject(**argsIter) ) {
 			usableFC = (FunctionObject*)(*argsIter);
 			if ( usableFC->getFunction(usableFunc) ) {
-				finalFunc->getPersistentScope().copyMembersFrom( usableFunc->getPersistentScope() );
+				if ( usableFunc->hasPersistentScope() )
+					finalFunc->getPersistentScope().copyMembersFrom( usableFunc->getPersistentScope() );
 			} else {
 				print( LogMessage::create(LogLevel::warning)
 					.SystemFunctionId( SystemFunction::_union )
@@ -6720,7 +8531,7 @@ Engine::process_sys_type(
 #ifdef COPPER_DEBUG_ENGINE_MESSAGES
 	print(LogLevel::debug, "[DEBUG: Engine::process_sys_type");
 #endif
-	ArgsIter argsIter = task.args.start();
+	ArgsBuffer::Iter argsIter = task.args.start();
 	if ( !argsIter.has() ) {
 		lastObject.setWithoutRef(new ObjectTypeObject());
 		return FuncExecReturn::Ran;
@@ -6737,9 +8548,9 @@ Engine::process_sys_are_same_type(
 #ifdef COPPER_DEBUG_ENGINE_MESSAGES
 	print(LogLevel::debug, "[DEBUG: Engine::process_sys_are_same_type");
 #endif
-	ArgsIter argsIter = task.args.start();
+	ArgsBuffer::Iter argsIter = task.args.start();
 	if ( !argsIter.has() ) {
-		lastObject.setWithoutRef(new BoolObject(false));
+		setLastObjectBool(false);
 		return FuncExecReturn::Ran;
 	}
 	// First parameter, to which all other parameters are compared
@@ -6753,7 +8564,7 @@ Engine::process_sys_are_same_type(
 			break;
 	}
 	// Get only the first parameter
-	lastObject.setWithoutRef(new BoolObject(same));
+	setLastObjectBool(same);
 	return FuncExecReturn::Ran;
 }
 
@@ -6764,9 +8575,9 @@ Engine::process_sys_are_type(
 #ifdef COPPER_DEBUG_ENGINE_MESSAGES
 	print(LogLevel::debug, "[DEBUG: Engine::process_sys_are_type");
 #endif
-	ArgsIter argsIter = task.args.start();
+	ArgsBuffer::Iter argsIter = task.args.start();
 	if ( !argsIter.has() ) {
-		lastObject.setWithoutRef(new BoolObject(false));
+		setLastObjectBool(false);
 		return FuncExecReturn::Ran;
 	}
 	if ( (*argsIter)->getType() != ObjectTypeObject::object_type ) {
@@ -6785,7 +8596,7 @@ Engine::process_sys_are_type(
 			break;
 	}
 	// Get only the first parameter
-	lastObject.setWithoutRef(new BoolObject(same));
+	setLastObjectBool(same);
 	return FuncExecReturn::Ran;
 }
 
@@ -6796,9 +8607,9 @@ Engine::process_sys_equal_type_value(
 #ifdef COPPER_DEBUG_ENGINE_MESSAGES
 	print(LogLevel::debug, "[DEBUG: Engine::process_sys_equal_type_value");
 #endif
-	ArgsIter argsIter = task.args.start();
+	ArgsBuffer::Iter argsIter = task.args.start();
 	if ( !argsIter.has() ) {
-		lastObject.setWithoutRef(new BoolObject(false));
+		setLastObjectBool(false);
 		return FuncExecReturn::Ran;
 	}
 	if ( (*argsIter)->getType() != ObjectTypeObject::object_type ) {
@@ -6826,7 +8637,7 @@ Engine::process_sys_equal_type_value(
 			break;
 	}
 	// Get only the first parameter
-	lastObject.setWithoutRef(new BoolObject(same));
+	setLastObjectBool(same);
 	return FuncExecReturn::Ran;
 }
 
@@ -6837,7 +8648,7 @@ Engine::process_sys_typename(
 #ifdef COPPER_DEBUG_ENGINE_MESSAGES
 	print(LogLevel::debug, "[DEBUG: Engine::process_sys_typename");
 #endif
-	ArgsIter argsIter = task.args.start();
+	ArgsBuffer::Iter argsIter = task.args.start();
 	if ( !argsIter.has() ) {
 		lastObject.setWithoutRef(new StringObject());
 		return FuncExecReturn::Ran;
@@ -6854,9 +8665,9 @@ Engine::process_sys_have_same_typename(
 #ifdef COPPER_DEBUG_ENGINE_MESSAGES
 	print(LogLevel::debug, "[DEBUG: Engine::process_sys_have_same_typename");
 #endif
-	ArgsIter argsIter = task.args.start();
+	ArgsBuffer::Iter argsIter = task.args.start();
 	if ( !argsIter.has() ) {
-		lastObject.setWithoutRef(new BoolObject(false));
+		setLastObjectBool(false);
 		return FuncExecReturn::Ran;
 	}
 	// First parameter, to which all other parameters are compared
@@ -6871,7 +8682,7 @@ Engine::process_sys_have_same_typename(
 
 	}
 	// Get only the first parameter
-	lastObject.setWithoutRef(new BoolObject(same));
+	setLastObjectBool(same);
 	return FuncExecReturn::Ran;
 }
 
@@ -6887,7 +8698,7 @@ Engine::process_sys_function_return_type(
 		return FuncExecReturn::ErrorOnRun;
 	}
 
-	ArgsIter argsIter = task.args.start();
+	ArgsBuffer::Iter argsIter = task.args.start();
 	if ( !argsIter.has() ) {
 		//lastObject.setWithoutRef(new NilObject()); // was new FunctionObject. Unnecessary.
 		return FuncExecReturn::Ran;
@@ -6922,9 +8733,9 @@ FuncExecReturn::Value
 Engine::process_sys_are_nil(
 	FuncFoundTask& task
 ) {
-	ArgsIter argsIter = task.args.start();
+	ArgsBuffer::Iter argsIter = task.args.start();
 	if ( !argsIter.has() ) {
-		lastObject.setWithoutRef(new BoolObject(false));
+		setLastObjectBool(false);
 		return FuncExecReturn::Ran;
 	}
 	// Check all parameters
@@ -6933,7 +8744,7 @@ Engine::process_sys_are_nil(
 		out = isNilObject(**argsIter);
 		if ( !out) break;
 	} while ( argsIter.next() );
-	lastObject.setWithoutRef(new BoolObject(out));
+	setLastObjectBool(out);
 	return FuncExecReturn::Ran;
 }
 
@@ -6944,9 +8755,9 @@ Engine::process_sys_are_bool(
 #ifdef COPPER_DEBUG_ENGINE_MESSAGES
 	print(LogLevel::debug, "[DEBUG: Engine::process_sys_are_bool");
 #endif
-	ArgsIter argsIter = task.args.start();
+	ArgsBuffer::Iter argsIter = task.args.start();
 	if ( !argsIter.has() ) {
-		lastObject.setWithoutRef(new BoolObject(false));
+		setLastObjectBool(false);
 		return FuncExecReturn::Ran;
 	}
 	// Check all parameters
@@ -6955,7 +8766,7 @@ Engine::process_sys_are_bool(
 		out = isBoolObject(**argsIter);
 		if ( !out) break;
 	} while ( argsIter.next() );
-	lastObject.setWithoutRef(new BoolObject(out));
+	setLastObjectBool(out);
 	return FuncExecReturn::Ran;
 }
 
@@ -6966,9 +8777,9 @@ Engine::process_sys_are_string(
 #ifdef COPPER_DEBUG_ENGINE_MESSAGES
 	print(LogLevel::debug, "[DEBUG: Engine::process_sys_are_string");
 #endif
-	ArgsIter argsIter = task.args.start();
+	ArgsBuffer::Iter argsIter = task.args.start();
 	if ( !argsIter.has() ) {
-		lastObject.setWithoutRef(new BoolObject(false));
+		setLastObjectBool(false);
 		return FuncExecReturn::Ran;
 	}
 	// Check all parameters
@@ -6978,7 +8789,7 @@ Engine::process_sys_are_string(
 		if ( !out)
 			break;
 	} while ( argsIter.next() );
-	lastObject.setWithoutRef(new BoolObject(out));
+	setLastObjectBool(out);
 	return FuncExecReturn::Ran;
 }
 
@@ -6989,9 +8800,9 @@ Engine::process_sys_are_list(
 #ifdef COPPER_DEBUG_ENGINE_MESSAGES
 	print(LogLevel::debug, "[DEBUG: Engine::process_sys_are_list");
 #endif
-	ArgsIter argsIter = task.args.start();
+	ArgsBuffer::Iter argsIter = task.args.start();
 	if ( !argsIter.has() ) {
-		lastObject.setWithoutRef(new BoolObject(false));
+		setLastObjectBool(false);
 		return FuncExecReturn::Ran;
 	}
 	// Check all parameters
@@ -7001,7 +8812,7 @@ Engine::process_sys_are_list(
 		if ( !out)
 			break;
 	} while ( argsIter.next() );
-	lastObject.setWithoutRef(new BoolObject(out));
+	setLastObjectBool(out);
 	return FuncExecReturn::Ran;
 }
 
@@ -7012,9 +8823,9 @@ Engine::process_sys_are_number(
 #ifdef COPPER_DEBUG_ENGINE_MESSAGES
 	print(LogLevel::debug, "[DEBUG: Engine::process_sys_are_number");
 #endif
-	ArgsIter argsIter = task.args.start();
+	ArgsBuffer::Iter argsIter = task.args.start();
 	if ( !argsIter.has() ) {
-		lastObject.setWithoutRef(new BoolObject(false));
+		setLastObjectBool(false);
 		return FuncExecReturn::Ran;
 	}
 	// Check all parameters
@@ -7024,7 +8835,7 @@ Engine::process_sys_are_number(
 		if ( !out)
 			break;
 	} while ( argsIter.next() );
-	lastObject.setWithoutRef(new BoolObject(out));
+	setLastObjectBool(out);
 	return FuncExecReturn::Ran;
 }
 
@@ -7035,9 +8846,9 @@ Engine::process_sys_are_integer(
 #ifdef COPPER_DEBUG_ENGINE_MESSAGES
 	print(LogLevel::debug, "[DEBUG: Engine::process_sys_are_integer");
 #endif
-	ArgsIter argsIter = task.args.start();
+	ArgsBuffer::Iter argsIter = task.args.start();
 	if ( !argsIter.has() ) {
-		lastObject.setWithoutRef(new BoolObject(false));
+		setLastObjectBool(false);
 		return FuncExecReturn::Ran;
 	}
 	// Check all parameters
@@ -7047,7 +8858,7 @@ Engine::process_sys_are_integer(
 		if ( !out)
 			break;
 	} while ( argsIter.next() );
-	lastObject.setWithoutRef(new BoolObject(out));
+	setLastObjectBool(out);
 	return FuncExecReturn::Ran;
 }
 
@@ -7058,9 +8869,9 @@ Engine::process_sys_are_decimal(
 #ifdef COPPER_DEBUG_ENGINE_MESSAGES
 	print(LogLevel::debug, "[DEBUG: Engine::process_sys_are_decimal");
 #endif
-	ArgsIter argsIter = task.args.start();
+	ArgsBuffer::Iter argsIter = task.args.start();
 	if ( !argsIter.has() ) {
-		lastObject.setWithoutRef(new BoolObject(false));
+		setLastObjectBool(false);
 		return FuncExecReturn::Ran;
 	}
 	// Check all parameters
@@ -7070,7 +8881,7 @@ Engine::process_sys_are_decimal(
 		if ( !out)
 			break;
 	} while ( argsIter.next() );
-	lastObject.setWithoutRef(new BoolObject(out));
+	setLastObjectBool(out);
 	return FuncExecReturn::Ran;
 }
 
@@ -7082,7 +8893,7 @@ Engine::process_sys_assert(
 #ifdef COPPER_DEBUG_ENGINE_MESSAGES
 	print(LogLevel::debug, "[DEBUG: Engine::process_sys_assert");
 #endif
-	ArgsIter argsIter = task.args.start();
+	ArgsBuffer::Iter argsIter = task.args.start();
 	if ( !argsIter.has() ) {
 		return FuncExecReturn::Ran;
 	}
@@ -7092,7 +8903,7 @@ Engine::process_sys_assert(
 			return FuncExecReturn::ErrorOnRun;
 		}
 	} while ( argsIter.next() );
-	lastObject.setWithoutRef(new BoolObject(true));
+	setLastObjectBool(true);
 	return FuncExecReturn::Ran;
 }
 
@@ -7103,7 +8914,7 @@ Engine::process_sys_copy(
 #ifdef COPPER_DEBUG_ENGINE_MESSAGES
 	print(LogLevel::debug, "[DEBUG: Engine::process_sys_copy");
 #endif
-	ArgsIter argsIter = task.args.start();
+	ArgsBuffer::Iter argsIter = task.args.start();
 	if ( argsIter.has() ) {
 		lastObject.setWithoutRef( (*argsIter)->copy() );
 	}
@@ -7128,7 +8939,7 @@ Engine::process_sys_construct_from_type(
 	ObjectType::Value  typeToConstruct = FunctionObject::object_type;
 	ObjectTypeObject* typeObject;
 	Object*  returnObject = REAL_NULL;
-	ArgsIter argsIter = task.args.start();
+	ArgsBuffer::Iter argsIter = task.args.start();
 	if ( (*argsIter)->getType() == ObjectTypeObject::object_type ) {
 		// First scenario: user passed in an object type object to indicate the type
 		typeObject = (ObjectTypeObject*)(*argsIter);
@@ -7184,7 +8995,7 @@ Engine::process_sys_construct_from_name(
 		return FuncExecReturn::ErrorOnRun;
 	}
 
-	ArgsIter  argsIter = task.args.start();
+	ArgsBuffer::Iter  argsIter = task.args.start();
 	if ( !isStringObject(**argsIter) ) {
 		printSystemFunctionWrongArg( SystemFunction::_construct_from_name, 1, 1,
 			(*argsIter)->getType(), StringObject::object_type );
@@ -7250,7 +9061,7 @@ Engine::process_sys_execute_with_alt_super(
 		return FuncExecReturn::ErrorOnRun;
 	}
 
-	ArgsIter argsIter = task.args.start();
+	ArgsBuffer::Iter argsIter = task.args.start();
 	Object* superObject = *argsIter;
 	argsIter.next();
 	Object* callObject = *argsIter;
@@ -7290,13 +9101,9 @@ Engine::process_sys_execute_with_alt_super(
 		return FuncExecReturn::Ran;
 	}
 
+	// Functions without a body (such as data-only functions) have nothing to run.
 	Body* body;
-	if ( ! func->body.obtain(body) ) {
-		print(LogLevel::error, "SYSTEM ERROR: Function body is missing.");
-		return FuncExecReturn::ErrorOnRun;
-	}
-
-	if ( body->isEmpty() ) {
+	if ( ! func->body.obtain(body) || body->isEmpty() ) {
 		return FuncExecReturn::Ran;
 	}
 
@@ -7306,25 +9113,25 @@ Engine::process_sys_execute_with_alt_super(
 	}
 
 	VarAddress* callAddress = new VarAddress();
-	callAddress->push_back("xwsv");
-	StackFrame* stackFrame = new StackFrame(callAddress);
+	callAddress->push_back(Symbol("xwsv"));
+	StackFrame& stackFrame = stack.push(callAddress, body->getLayout());
 	callAddress->deref();
 
 	// Add "super" pointer
-	stackFrame->getScope().setVariableFrom(CONSTANT_FUNCTION_SUPER, superObject, true);
+	stackFrame.setVariableFrom(SYMBOL_FUNCTION_SUPER, superObject, true);
 
 	// Add "this" pointer
-	stackFrame->getScope().setVariableFrom(CONSTANT_FUNCTION_SELF, callObject, true);
+	stackFrame.setVariableFrom(SYMBOL_FUNCTION_SELF, callObject, true);
 
 	// Assign arguments to each function parameter name.
 	// The first two arguments were used, so we use the remainder.
-	List<String>::Iter funcParamsIter = func->params.start();
+	List<Symbol>::Iter funcParamsIter = func->params.start();
 	bool done = false;
 	if ( funcParamsIter.has() ) {
 		if ( argsIter.has() )
 		do {
 			// Match parameters with parameter list items
-			stackFrame->getScope().setVariableFrom( *funcParamsIter, *argsIter, true );
+			stackFrame.setVariableFrom( *funcParamsIter, *argsIter, true );
 			if ( ! funcParamsIter.next() ) {
 				done = true;
 				break;
@@ -7334,14 +9141,12 @@ Engine::process_sys_execute_with_alt_super(
 		do {
 			print( LogLevel::warning, EngineMessage::MissingFunctionCallArg );
 			// Default remaining parameters to empty function.
-			stackFrame->getScope().addVariable( *funcParamsIter );
+			stackFrame.addVariable( *funcParamsIter );
 		} while ( funcParamsIter.next() );
 	}
 	// TODO: Leftover task arguments may eventually be stored in a splat variable or included as part
 	// of an all-inclusive "arguments" list.
 
-	stack.push(stackFrame);
-	stackFrame->deref();
 
 	addOpStrandToStack(body->getOpcodeStrand());
 	opStrandStackIter.next();
@@ -7356,7 +9161,7 @@ Engine::process_sys_share_body(
 #ifdef COPPER_DEBUG_ENGINE_MESSAGES
 	print(LogLevel::debug, "[DEBUG: Engine::process_sys_share_body");
 #endif
-	ArgsIter argsIter = task.args.start();
+	ArgsBuffer::Iter argsIter = task.args.start();
 
 	if ( task.args.size() < 2 ) {
 		printSystemFunctionWrongArgCount( SystemFunction::_share_body, task.args.size(), 2 );
@@ -7432,7 +9237,7 @@ Engine::process_sys_make_list(
 #ifdef COPPER_DEBUG_ENGINE_MESSAGES
 	print(LogLevel::debug, "[DEBUG: Engine::process_sys_make_list");
 #endif
-	ArgsIter argsIter = task.args.start();
+	ArgsBuffer::Iter argsIter = task.args.start();
 	ListObject* out = new ListObject();
 	lastObject.setWithoutRef(out);
 	if ( argsIter.has() ) {
@@ -7455,7 +9260,7 @@ Engine::process_sys_list_size(
 		return FuncExecReturn::ErrorOnRun;
 	}
 
-	ArgsIter argsIter = task.args.start();
+	ArgsBuffer::Iter argsIter = task.args.start();
 
 	if ( ! isListObject(**argsIter) ) {
 		printSystemFunctionWrongArg( SystemFunction::_list_size, 1, 1,
@@ -7483,7 +9288,7 @@ Engine::process_sys_list_append(
 		return FuncExecReturn::ErrorOnRun;
 	}
 
-	ArgsIter argsIter = task.args.start();
+	ArgsBuffer::Iter argsIter = task.args.start();
 
 	if ( ! isListObject(**argsIter) ) {
 		printSystemFunctionWrongArg( SystemFunction::_list_append, 1, 2,
@@ -7511,7 +9316,7 @@ Engine::process_sys_list_prepend(
 		return FuncExecReturn::ErrorOnRun;
 	}
 
-	ArgsIter argsIter = task.args.start();
+	ArgsBuffer::Iter argsIter = task.args.start();
 
 	if ( ! isListObject(**argsIter) ) {
 		printSystemFunctionWrongArg( SystemFunction::_list_prepend, 1, 2,
@@ -7539,7 +9344,7 @@ Engine::process_sys_list_insert(
 		return FuncExecReturn::ErrorOnRun;
 	}
 
-	ArgsIter argsIter = task.args.start();
+	ArgsBuffer::Iter argsIter = task.args.start();
 
 	if ( ! isListObject(**argsIter) ) {
 		printSystemFunctionWrongArg( SystemFunction::_list_insert, 1, 3,
@@ -7578,7 +9383,7 @@ Engine::process_sys_list_get_item(
 		return FuncExecReturn::ErrorOnRun;
 	}
 
-	ArgsIter argsIter = task.args.start();
+	ArgsBuffer::Iter argsIter = task.args.start();
 
 	if ( ! isListObject(**argsIter) ) {
 		printSystemFunctionWrongArg( SystemFunction::_list_get_item, 1, 2,
@@ -7617,7 +9422,7 @@ Engine::process_sys_list_remove(
 		return FuncExecReturn::ErrorOnRun;
 	}
 
-	ArgsIter argsIter = task.args.start();
+	ArgsBuffer::Iter argsIter = task.args.start();
 
 	if ( ! isListObject(**argsIter) ) {
 		printSystemFunctionWrongArg( SystemFunction::_list_remove, 1, 2,
@@ -7653,7 +9458,7 @@ Engine::process_sys_list_clear(
 		return FuncExecReturn::ErrorOnRun;
 	}
 
-	ArgsIter argsIter = task.args.start();
+	ArgsBuffer::Iter argsIter = task.args.start();
 
 	if ( ! isListObject(**argsIter) ) {
 		printSystemFunctionWrongArg( SystemFunction::_list_clear, 1, 1,
@@ -7677,7 +9482,7 @@ Engine::process_sys_list_swap(
 		return FuncExecReturn::ErrorOnRun;
 	}
 
-	ArgsIter argsIter = task.args.start();
+	ArgsBuffer::Iter argsIter = task.args.start();
 
 	if ( ! isListObject(**argsIter) ) {
 		printSystemFunctionWrongArg( SystemFunction::_list_swap, 1, 3,
@@ -7724,7 +9529,7 @@ Engine::process_sys_list_replace(
 		return FuncExecReturn::ErrorOnRun;
 	}
 
-	ArgsIter argsIter = task.args.start();
+	ArgsBuffer::Iter argsIter = task.args.start();
 
 	if ( ! isListObject(**argsIter) ) {
 		printSystemFunctionWrongArg( SystemFunction::_list_replace, 1, 3,
@@ -7763,7 +9568,7 @@ Engine::process_sys_list_sublist(
 		return FuncExecReturn::ErrorOnRun;
 	}
 
-	ArgsIter argsIter = task.args.start();
+	ArgsBuffer::Iter argsIter = task.args.start();
 
 	if ( ! isListObject(**argsIter) ) {
 		printSystemFunctionWrongArg( SystemFunction::_list_sublist, 1, 3,
@@ -7828,7 +9633,7 @@ Engine::process_sys_string_match(
 #ifdef COPPER_DEBUG_ENGINE_MESSAGES
 	print(LogLevel::debug, "[DEBUG: Engine::process_sys_string_match");
 #endif
-	ArgsIter  argsIter = task.args.start();
+	ArgsBuffer::Iter  argsIter = task.args.start();
 	bool  matches = true;
 	String*  base_string = REAL_NULL;
 	UInteger  argIndex = 1; // For printing
@@ -7849,7 +9654,7 @@ Engine::process_sys_string_match(
 			++argIndex;
 		} while ( argsIter.next() && matches );
 	}
-	lastObject.setWithoutRef( new BoolObject(matches) );
+	setLastObjectBool(matches);
 	return FuncExecReturn::Ran;
 }
 
@@ -7860,7 +9665,7 @@ Engine::process_sys_string_concat(
 #ifdef COPPER_DEBUG_ENGINE_MESSAGES
 	print(LogLevel::debug, "[DEBUG: Engine::process_sys_string_concat");
 #endif
-	ArgsIter argsIter = task.args.start();
+	ArgsBuffer::Iter argsIter = task.args.start();
 	CharList builder;
 	String part_str;
 	if ( argsIter.has() ) {
@@ -7886,9 +9691,19 @@ Engine::process_sys_num_chain_num(
 ) {
 	NumericObject*  startNumber = REAL_NULL;
 	NumericObject*  resultNumber = REAL_NULL;
-	ArgsIter  argsIter = task.args.start();
+	ArgsBuffer::Iter  argsIter = task.args.start();
 	UInteger  argIndex = 1; // For printing
 
+	// Functions that modify the first number (such as +=) can't skip creating objects.
+	if ( task.args.size() > 1
+		&& functionId != SystemFunction::_num_incr_2
+		&& functionId != SystemFunction::_num_decr_2
+		&& task.args.getFirst()->getType() == ObjectType::Numeric
+		&& ((NumericObject*)task.args.getFirst())->getNumberType() != ObjectType::Numeric
+	) {
+		return process_sys_num_chain_unboxed(task, functionId);
+	}
+
 	if ( argsIter.has() ) {
 		if ( isNumericObject(**argsIter) ) {
 			startNumber = (NumericObject*)*argsIter;
@@ -7915,6 +9730,68 @@ Engine::process_sys_num_chain_num(
 	return FuncExecReturn::Ran;
 }
 
+FuncExecReturn::Value
+Engine::process_sys_num_chain_unboxed(
+	FuncFoundTask&  task,
+	SystemFunction::Value  functionId
+) {
+	ArgsBuffer::Iter  argsIter = task.args.start();
+	UInteger  argIndex = 1; // For printing
+	NumericObject*  number = (NumericObject*)*argsIter;
+	// As with the number classes, the type of the first number decides the type of the result.
+	bool  isInteger = ( number->getNumberType() == ObjectType::Integer );
+	Integer  integerResult = 0;
+	Decimal  decimalResult = 0;
+
+	if ( isInteger )
+		integerResult = unboxInteger(*number);
+	else
+		decimalResult = unboxDecimal(*number);
+
+	while ( argsIter.next() ) {
+		++argIndex;
+		if ( ! isNumericObject(**argsIter) ) {
+			printSystemFunctionWrongArg( functionId, argIndex, 0, (*argsIter)->getType(), NumericObject::object_type, false );
+			continue;
+		}
+		number = (NumericObject*)*argsIter;
+		if ( isInteger ) {
+			switch( functionId ) {
+			case SystemFunction::_num_add:
+				integerResult = integerAdd( integerResult, unboxInteger(*number) ); break;
+			case SystemFunction::_num_subtract:
+				integerResult = integerSubtract( integerResult, unboxInteger(*number) ); break;
+			case SystemFunction::_num_multiply:
+				integerResult = integerMultiply( integerResult, unboxInteger(*number) ); break;
+			case SystemFunction::_num_divide:
+				integerResult = integerDivide( integerResult, unboxInteger(*number) ); break;
+			default: // _num_modulus
+				integerResult = integerResult % unboxInteger(*number); break;
+			}
+		} else {
+			switch( functionId ) {
+			case SystemFunction::_num_add:
+				decimalResult = decimalResult + unboxDecimal(*number); break;
+			case SystemFunction::_num_subtract:
+				decimalResult = decimalResult - unboxDecimal(*number); break;
+			case SystemFunction::_num_multiply:
+				decimalResult = decimalResult * unboxDecimal(*number); break;
+			case SystemFunction::_num_divide:
+				decimalResult = decimalDivide( decimalResult, unboxDecimal(*number) ); break;
+			default: // _num_modulus results in an integer, as in DecimalNumObject::modulus()
+				integerResult = Integer(decimalResult) % unboxInteger(*number);
+				isInteger = true;
+				break;
+			}
+		}
+	}
+	if ( isInteger )
+		lastObject.setWithoutRef( new IntegerObject(integerResult) );
+	else
+		lastObject.setWithoutRef( new DecimalNumObject(decimalResult) );
+	return FuncExecReturn::Ran;
+}
+
 FuncExecReturn::Value
 Engine::process_sys_solo_num(
 	FuncFoundTask& task,
@@ -7922,7 +9799,7 @@ Engine::process_sys_solo_num(
 	SystemFunction::Value  functionId
 ) {
 	NumericObject*  number = REAL_NULL;
-	ArgsIter argsIter = task.args.start();
+	ArgsBuffer::Iter argsIter = task.args.start();
 	if ( argsIter.has() ) {
 		if ( isNumericObject(**argsIter) ) {
 			number = (NumericObject*)*argsIter;
@@ -7942,7 +9819,7 @@ FuncExecReturn::Value
 Engine::process_sys_num_equal( FuncFoundTask& task ) {
 	bool  result = true;
 	NumericObject*  first;
-	ArgsIter  argsIter = task.args.start();
+	ArgsBuffer::Iter  argsIter = task.args.start();
 	UInteger  argIndex = 0; // For printing
 
 	if ( argsIter.has() ) {
@@ -7967,7 +9844,7 @@ Engine::process_sys_num_equal( FuncFoundTask& task ) {
 			}
 		}
 	}
-	lastObject.setWithoutRef( new BoolObject(result) );
+	setLastObjectBool(result);
 	return FuncExecReturn::Ran;
 }
 
@@ -7975,7 +9852,7 @@ FuncExecReturn::Value
 Engine::process_sys_num_greater_than( FuncFoundTask& task, bool flip ) {
 	bool result = true;
 	NumericObject*  first;
-	ArgsIter argsIter = task.args.start();
+	ArgsBuffer::Iter argsIter = task.args.start();
 	UInteger  argIndex = 0; // For printing
 
 	if ( argsIter.has() ) {
@@ -8018,7 +9895,7 @@ Engine::process_sys_num_greater_than( FuncFoundTask& task, bool flip ) {
 			}
 		}
 	}
-	lastObject.setWithoutRef( new BoolObject(result) );
+	setLastObjectBool(result);
 	return FuncExecReturn::Ran;
 }
 
@@ -8026,7 +9903,7 @@ FuncExecReturn::Value
 Engine::process_sys_num_greater_or_equal( FuncFoundTask& task, bool flip ) {
 	bool  result = true;
 	NumericObject*  first;
-	ArgsIter  argsIter = task.args.start();
+	ArgsBuffer::Iter  argsIter = task.args.start();
 	UInteger  argIndex = 0; // For printing
 
 	if ( argsIter.has() ) {
@@ -8069,13 +9946,13 @@ Engine::process_sys_num_greater_or_equal( FuncFoundTask& task, bool flip ) {
 			}
 		}
 	}
-	lastObject.setWithoutRef( new BoolObject(result) );
+	setLastObjectBool(result);
 	return FuncExecReturn::Ran;
 }
 
 FuncExecReturn::Value
 Engine::process_sys_num_abs( FuncFoundTask& task ) {
-	ArgsIter argsIter = task.args.start();
+	ArgsBuffer::Iter argsIter = task.args.start();
 	if ( argsIter.has() ) {
 		if ( isNumericObject(**argsIter) ) {
 			lastObject.setWithoutRef( ((NumericObject*)*argsIter)->absValue() );
@@ -8116,7 +9993,7 @@ NumericObject*
 Engine::process_sys_num_incr( NumericObject& base ) {
 	// TODO: Add an increment function to the objects themselves, which is much faster
 	NumericObject* out = base.add(IntegerObject(1));
-	base.setValue(*out);
+	base.setValue(*out); // Does nothing to shared literals
 	return out;
 }
 
@@ -8124,13 +10001,15 @@ NumericObject*
 Engine::process_sys_num_decr( NumericObject& base ) {
 	// TODO: Add a decrement function to the objects themselves, which is much faster
 	NumericObject* out = base.subtract(IntegerObject(1));
-	base.setValue(*out);
+	base.setValue(*out); // Does nothing to shared literals
 	return out;
 }
 
 NumericObject*
 Engine::process_sys_num_incr2( NumericObject& first, NumericObject& second ) {
 	NumericObject* result = first.add(second);
+	if ( first.isConstant() )
+		return result; // Literals are shared, so only the result changes
 	first.setValue(*result);
 	result->deref();
 	first.ref();
@@ -8140,6 +10019,8 @@ Engine::process_sys_num_incr2( NumericObject& first, NumericObject& second ) {
 NumericObject*
 Engine::process_sys_num_decr2( NumericObject& first, NumericObject& second ) {
 	NumericObject* result = first.subtract(second);
+	if ( first.isConstant() )
+		return result; // Literals are shared, so only the result changes
 	first.setValue(*result);
 	result->deref();
 	first.ref();
@@ -54,6 +54,15 @@
 # define CU_UNUSED_ARG(x) x
 #endif
 
+// For marking intended fall through to the next case for GCC's -Wimplicit-fallthrough.
+#if __cplusplus >= 201703L
+# define CU_FALLTHROUGH [[fallthrough]]
+#elif defined(__GNUC__) && __GNUC__ >= 7
+# define CU_FALLTHROUGH __attribute__((__fallthrough__))
+#else
+# define CU_FALLTHROUGH
+#endif
+
 
 // ******* Null *******
 
@@ -91,7 +100,7 @@
 
 // ******* Virtual machine version *******
 
-#define COPPER_INTERPRETER_VERSION 0.711
+#define COPPER_INTERPRETER_VERSION 0.72
 #define COPPER_INTERPRETER_BRANCH 6
 
 // ******* Language version *******
@@ -119,6 +128,51 @@
 #undef COPPER_ENABLE_NUMERIC_NAMES
 #endif
 
+// ******* Performance *******
+
+// Uncomment to have Engine::operate() jump directly from one opcode handler to the next using
+// labels-as-values (computed goto) rather than returning to Engine::execute() after every opcode.
+// This requires GCC or Clang. Other compilers use the switch.
+#define COPPER_ENABLE_COMPUTED_GOTO
+
+#ifdef UNDEF_COPPER_ENABLE_COMPUTED_GOTO
+#undef COPPER_ENABLE_COMPUTED_GOTO
+#endif
+
+#if defined(COPPER_ENABLE_COMPUTED_GOTO) && !defined(__GNUC__)
+#undef COPPER_ENABLE_COMPUTED_GOTO
+#endif
+
+// Uncomment to have Body::compile() optimize the opcodes of function bodies. Built-in calls on
+// literal values are replaced by their results, jump chains are shortened, and unreachable
+// opcodes and unneeded terminals are removed. Disable to debug the opcodes as parsed.
+#define COPPER_ENABLE_BODY_OPTIMIZER
+
+#ifdef UNDEF_COPPER_ENABLE_BODY_OPTIMIZER
+#undef COPPER_ENABLE_BODY_OPTIMIZER
+#endif
+
+// Uncomment to have if-structure conditions that are a call to a comparison or boolean built-in
+// function (such as gt(), equal(), matching(), or not()) tested and jumped on by one opcode.
+// The arguments are compared where they are, without a task for the call.
+#define COPPER_ENABLE_FUSED_CONDITIONS
+
+#ifdef UNDEF_COPPER_ENABLE_FUSED_CONDITIONS
+#undef COPPER_ENABLE_FUSED_CONDITIONS
+#endif
+
+// Uncomment to have variable accesses and function calls rewrite their opcodes after running
+// into forms specialized for what they found (a frame slot, a global, or a user function).
+// The specialized forms check that this is still true and otherwise return to the general form.
+#define COPPER_ENABLE_QUICKENING
+
+#ifdef UNDEF_COPPER_ENABLE_QUICKENING
+#undef COPPER_ENABLE_QUICKENING
+#endif
+
+// Reference-counted classes, address nodes, and list nodes are allocated from size-classed slabs
+// when COPPER_USE_SLAB_ALLOCATOR is defined. It is set in SlabAllocator.h because util::List uses it too.
+
 //! Open-body token cap
 // While the engine technically supports the full range of uint,
 // the actual memory available to the program is limited and hampered by the fact
@@ -126,6 +180,10 @@
 // of active open function parameter bodies and execution bodies must be limited.
 #define PARSER_OPENBODY_MAX_COUNT 350
 
+//! Built-in function call argument cap
+// Calls to built-in functions store their argument count in 16 bits of the instruction.
+#define PARSER_SYSCALL_ARGS_MAX_COUNT 0xffff
+
 //! Initial size of function scope
 #define CU_FUNCTION_SCOPE_SIZE 8
 // util::ERHHS_SMALL
@@ -136,6 +194,21 @@
 // util::ERHHS_BIG
 // was 50
 
+//! Number of function-call arguments stored without heap allocation
+#define CU_ARGS_INLINE_SIZE 8
+
+//! Number of opcode strand containers stored without heap allocation
+#define CU_OPSTRAND_STACK_INLINE_SIZE 4
+
+//! Size of each memory region from which the frames of the stack are carved
+#define CU_STACK_REGION_SIZE 16384
+
+//! Initial capacity of the engine's task stack
+#define CU_TASK_STACK_INITIAL_SIZE 16
+
+//! Maximum number of finished function-call tasks the engine keeps for reuse
+#define CU_SPARE_FUNC_FOUND_TASKS 32
+
 //! Allows for bounds-checking on integers
 // Slow but safe. Requires <limits>, however.
 //#define ENABLE_COPPER_NUMERIC_BOUNDS_CHECKS
@@ -158,7 +231,9 @@ class BadParameterException {};
 
 #include "utilList.h"
 #include "RHHash.h"
+#include "SlabAllocator.h"
 #include "Strings.h"
+#include "ByteScan.h"
 
 namespace Cu {
 
@@ -168,6 +243,7 @@ using util::uint;
 using util::List;
 using util::CharList;
 using util::String;
+using util::StringSpan;
 using util::RobinHoodHash;
 
 // ******* Virtual Machine Types ********
@@ -366,6 +442,10 @@ struct EngineMessage {
 	// Trying to create more parameter bodies within a function header than feasible.
 	ExceededParamBodyCountLimit,
 
+	// ERROR
+	// Trying to pass more arguments to a built-in function than can be stored.
+	ExceededSysCallArgCountLimit,
+
 	// ERROR
 	// Stream ended before arguments could be collected for a function call.
 	ArgBodyIncomplete,
@@ -568,11 +648,135 @@ struct ExecutionResult {
 /*
 This MUST be a buffered stream - that is, one possessing another byte.
 atEOS() is to return false if another byte is in the buffer or guaranteed to be (such as from stdin).
+Streams holding their bytes in memory should also override peekBlock() and skipBytes() so that the
+lexer can read whole blocks of bytes rather than make two virtual calls per byte.
 */
 struct ByteStream {
+	ByteStream()
+		: adapterByte(' ')
+		, adapterHasByte(false)
+	{}
+
 	virtual ~ByteStream() {};
 	virtual char getNextByte()=0;
 	virtual bool atEOS()=0;
+
+	/* Points pBlock at the next bytes of the stream without consuming them and returns their count.
+	Returns 0 at the end of the stream. The bytes remain valid until skipBytes() is called.
+	By default, this gives one byte at a time from getNextByte(). */
+	virtual uint peekBlock( const char*&  pBlock ) {
+		if ( ! adapterHasByte ) {
+			if ( atEOS() )
+				return 0;
+			adapterByte = getNextByte();
+			adapterHasByte = true;
+		}
+		pBlock = &adapterByte;
+		return 1;
+	}
+
+	/* Consumes the given number of bytes from the start of the block given by peekBlock(). */
+	virtual void skipBytes( uint  pCount ) {
+		if ( pCount > 0 )
+			adapterHasByte = false;
+	}
+
+private:
+	char adapterByte;
+	bool adapterHasByte;
+};
+
+//! Byte Stream Reader
+/*
+Reads the bytes of a ByteStream block by block for the lexer.
+The bytes that have been read are consumed from the stream when the reader is destroyed,
+so a stream left by an error resumes after the byte that caused it.
+Once the stream has ended, the reader does not ask it for more bytes. (Interactive streams, such as
+the console, report the end of the stream at the end of each line but continue afterwards.)
+*/
+class ByteStreamReader {
+	ByteStream&  stream;
+	const char*  blockStart;
+	const char*  position;
+	const char*  blockEnd;
+	bool  streamEnded;
+
+public:
+	ByteStreamReader( ByteStream&  pStream )
+		: stream(pStream)
+		, blockStart(REAL_NULL)
+		, position(REAL_NULL)
+		, blockEnd(REAL_NULL)
+		, streamEnded(false)
+	{}
+
+	~ByteStreamReader() {
+		if ( position != blockStart )
+			stream.skipBytes( (uint)(position - blockStart) );
+	}
+
+	// Returns false if the stream has ended.
+	bool next( char&  c ) {
+		if ( position == blockEnd && ! nextBlock() )
+			return false;
+		c = *position;
+		++position;
+		return true;
+	}
+
+	// Reads until one of the given bytes is found, which is then returned in c.
+	// Returns false if the stream ended first.
+	bool nextOf( const char  pFirst, const char  pSecond, char&  c ) {
+		do {
+			position = util::findEitherByte(position, blockEnd, pFirst, pSecond);
+			if ( position != blockEnd ) {
+				c = *position;
+				++position;
+				return true;
+			}
+		} while ( nextBlock() );
+		return false;
+	}
+
+	// Reads the bytes before the next byte equal to either of the given bytes, stopping at the end
+	// of the block. The byte found is read next. The run remains valid until the block is left.
+	// Returns false if the stream has ended.
+	bool nextRun( const char  pFirst, const char  pSecond, StringSpan&  pRun ) {
+		if ( position == blockEnd && ! nextBlock() )
+			return false;
+		const char*  runEnd = util::findEitherByte(position, blockEnd, pFirst, pSecond);
+		pRun = StringSpan(position, (uint)(runEnd - position));
+		position = runEnd;
+		return true;
+	}
+
+	bool atBlockEnd() const {
+		return position == blockEnd;
+	}
+
+	// Skips the whitespace that follows in the current block.
+	void skipWhitespace() {
+		position = util::skipWhitespaceBytes(position, blockEnd);
+	}
+
+private:
+	bool nextBlock() {
+		if ( streamEnded )
+			return false;
+		if ( position != blockStart )
+			stream.skipBytes( (uint)(position - blockStart) );
+		const uint size = stream.peekBlock(blockStart);
+		if ( size == 0 ) {
+			streamEnded = true;
+			blockStart = REAL_NULL;
+			position = REAL_NULL;
+			blockEnd = REAL_NULL;
+			return false;
+		}
+		position = blockStart;
+		blockEnd = blockStart + size;
+		return true;
+	}
 };
 
 //-------------------
@@ -777,14 +981,134 @@ struct TaskType {
 
 //----------
 
-struct Token {
-	const String name;
-	const TokenType type;
+//! Reserved Name
+/*
+	A name with meaning to the engine: a keyword, a name parsed as its own task (SRPS), or the
+	name of a built-in function. Reserved names are the first symbols interned (in the order of
+	their table), so a symbol is classified by indexing the table with its ID.
+*/
+struct ReservedName {
+	enum Kind {
+		Keyword,
+		Own, // SRPS names
+		IsOwner,
+		IsPointer,
+		Builtin
+	};
 
-	Token( TokenType pType, const String& pName ) : name(pName), type(pType) {}
-	Token( TokenType pType ) : name(), type(pType) {}
+	const char*  name;
+	Kind  kind;
+	TokenType  tokenType; // TT_name for all but keywords
+	SystemFunction::Value  sysFunc; // _unset for all but built-in functions
 };
 
+//----------
+
+//! Symbol
+/*
+	An interned name. Names are interned once (usually when tokenized) into the SymbolTable of
+	the engines, so symbols can be hashed and compared as integers.
+	Symbols are not removed from the table until it is freed with the last engine.
+*/
+class Symbol {
+	UInteger  id;
+
+public:
+	// The empty name
+	Symbol()
+		: id(0)
+	{}
+
+	// Interns the given name. Explicit so that names are only interned where they are meant to be
+	// (such as by creating variables) rather than whenever a String is used to look one up.
+	explicit Symbol( const String&  pName );
+	explicit Symbol( const char*  pName );
+	explicit Symbol( const StringSpan&  pName );
+
+	UInteger
+	getId() const {
+		return id;
+	}
+
+	// Sets pSymbol to the symbol of the name only if the name has already been interned.
+	// Returns false otherwise, since no scope can have a variable by that name.
+	static bool
+	find( const String&  pName, Symbol&  pSymbol );
+
+	// Recreates the symbol of the given ID (from getId())
+	static Symbol
+	fromId( UInteger  pId ) {
+		Symbol  s;
+		s.id = pId;
+		return s;
+	}
+
+	const String&
+	getName() const;
+
+	// Returns the reserved name entry of this symbol or REAL_NULL if the name is not reserved
+	const ReservedName*
+	getReservedName() const;
+
+	// For RobinHoodHash. IDs are sequential, so they need no further hashing.
+	uint
+	keyValue() const {
+		return id;
+	}
+
+	bool
+	equals( const Symbol&  pOther ) const {
+		return id == pOther.id;
+	}
+};
+
+//! Symbol Table
+/*
+	Names of the symbols, indexed by ID. The table belongs to the engines: it is created when first
+	needed and freed when the last engine is destroyed. Engines that exist at the same time share it
+	because objects (and so their scopes) may be passed between them.
+	Symbols (and objects with members) should not be kept after the engines are destroyed.
+	Names given at runtime should be looked up with find(), which does not intern them.
+
+	Limitations:
+	- Not thread-safe. The table and its owner count are shared by all engines without locking,
+	so engines must not create or destroy symbols on separate threads at the same time (as with
+	the slab allocator; see SlabAllocator.h).
+*/
+class SymbolTable {
+	RobinHoodHash<UInteger>  ids;
+	String**  names;
+	UInteger  count;
+	UInteger  capacity;
+
+	static SymbolTable*  shared;
+	static UInteger  ownerCount;
+
+	SymbolTable();
+	~SymbolTable();
+
+public:
+	// Held by each engine. The table is freed when the last owner is destroyed.
+	class Owner {
+	public:
+		Owner();
+		Owner( const Owner&  pOther );
+		~Owner();
+	};
+
+	static SymbolTable&  get();
+
+	UInteger  intern( const String&  pName );
+	UInteger  intern( const StringSpan&  pName ); // Copies the name only if it is new
+	UInteger  find( const StringSpan&  pName ); // Returns 0 (the empty name) if the name is not interned
+	const String&  getName( UInteger  pId ) const;
+	UInteger  size() const;
+};
+
+//----------
+
+struct Token; // predeclaration
+
 //--------------
 
 // Log Levels for filtering information to be printed
@@ -935,6 +1259,21 @@ public:
 #endif
 	}
 
+#ifdef COPPER_USE_SLAB_ALLOCATOR
+	static void* operator new( size_t  pSize ) {
+		return util::SlabAllocator::allocate(pSize);
+	}
+
+	static void* operator new( size_t, void*  pPlace ) {
+		return pPlace;
+	}
+
+	// Virtual destructors ensure the size is that of the actual class
+	static void operator delete( void*  pBlock, size_t  pSize ) {
+		util::SlabAllocator::release(pBlock, pSize);
+	}
+#endif
+
 	virtual ~Ref() {
 		// Some people gawk at this, but it's actually useful in debugging.
 #ifdef COPPER_REF_LEVEL_MESSAGES
@@ -1131,34 +1470,255 @@ struct Task : public Ref {
 #endif
 };
 
-class TaskContainer {
-	Task* task;
+//! Task Stack
+/*
+	A contiguous stack of the function-building and function-calling tasks in progress.
+	The stack owns one reference of each task it holds.
+*/
+class TaskStack {
+	Task**  tasks;
+	uint  count;
+	uint  capacity;
+
+	void grow() {
+		Task** newTasks = new Task*[capacity * 2];
+		std::memcpy( (void*)newTasks, (void*)tasks, sizeof(Task*) * count );
+		delete[] tasks;
+		tasks = newTasks;
+		capacity *= 2;
+	}
+
+	// Disallow copies
+	TaskStack( const TaskStack& );
+	TaskStack& operator= ( const TaskStack& );
+
 public:
+	TaskStack()
+		: tasks(new Task*[CU_TASK_STACK_INITIAL_SIZE])
+		, count(0)
+		, capacity(CU_TASK_STACK_INITIAL_SIZE)
+	{}
+
+	~TaskStack() {
+		clear();
+		delete[] tasks;
+	}
+
 	// Expected to be passed: new Task() (e.g. "new FuncFoundTask()")
-	TaskContainer(Task* newTask)
-		: task(newTask)
+	// The stack takes over the reference.
+	void push( Task*  pTask ) {
+		if ( count == capacity )
+			grow();
+		tasks[count] = pTask;
+		++count;
+	}
+
+	Task* getLast() const {
+		return tasks[count - 1];
+	}
+
+	// Index 0 is the bottom of the stack
+	Task* get( uint  pIndex ) const {
+		return tasks[pIndex];
+	}
+
+	// Removes the last task and releases the stack's reference
+	void pop() {
+		if ( count > 0 ) {
+			--count;
+			tasks[count]->deref();
+		}
+	}
+
+	// Removes the last task and hands the stack's reference to the caller
+	Task* takeLast() {
+		--count;
+		return tasks[count];
+	}
+
+	uint size() const {
+		return count;
+	}
+
+	bool has() const {
+		return count > 0;
+	}
+
+	void clear() {
+		while ( count > 0 )
+			pop();
+	}
+};
+
+//! Token Literal
+// The text of a string or number token, shared by the copies of the token.
+struct TokenLiteral : public Ref {
+	const String text;
+
+	TokenLiteral( const String&  pText )
+		: text(pText)
 	{}
 
-	TaskContainer(const TaskContainer& pOther)
-		: task(pOther.task)
+	TokenLiteral( const CharList&  pText )
+		: text(pText)
+	{}
+
+	TokenLiteral( const StringSpan&  pText )
+		: text(pText)
+	{}
+
+#ifdef COPPER_USE_DEBUG_NAMES
+	virtual const char* getDebugName() const {
+		return "TokenLiteral";
+	}
+#endif
+};
+
+/*
+	Names, keywords, and punctuation are held as symbols, so creating and copying them
+	never allocates. Only strings and numbers have their text stored.
+*/
+struct Token {
+	TokenType type;
+	Symbol symbol; // The text of all tokens except literals
+	RefPtr<TokenLiteral> literal; // Only set for strings and numbers
+
+	Token()
+		: type(TT_unknown)
+		, symbol()
+		, literal()
+	{}
+
+	Token( TokenType pType )
+		: type(pType)
+		, symbol()
+		, literal()
+	{}
+
+	Token( TokenType pType, const Symbol& pSymbol )
+		: type(pType)
+		, symbol(pSymbol)
+		, literal()
+	{}
+
+	// Takes the given (new) literal
+	Token( TokenType pType, TokenLiteral* pLiteral )
+		: type(pType)
+		, symbol()
+		, literal()
 	{
-		task->ref();
+		literal.setWithoutRef(pLiteral);
 	}
 
-	~TaskContainer() {
-		task->deref();
+	const String& getText() const {
+		TokenLiteral* l = literal.raw();
+		return notNull(l) ? l->text : symbol.getName();
+	}
+};
+
+//! Token Queue
+/*
+	Contiguous queue of tokens.
+	Tokens removed from the front leave their slots empty until more room is needed, at which
+	point the remaining tokens are moved to the front of the array.
+	Iterators hold positions counted from the first token ever added to the queue, so they remain
+	valid when tokens are moved.
+*/
+class TokenQueue {
+	Token* tokens;
+	uint capacity;
+	uint first; // Index of the first token
+	uint end; // Index after the last token
+	uint removed; // Count of the tokens moved out of the array. Positions are indices plus this.
+
+	TokenQueue( const TokenQueue& ); // Not copyable
+	TokenQueue& operator=( const TokenQueue& );
+
+public:
+	class Iter {
+		friend TokenQueue;
+		TokenQueue* queue;
+		uint position;
+
+	public:
+		// Unset iterator
+		Iter()
+			: queue(REAL_NULL)
+			, position(0)
+		{}
+
+		// Iterator at the first token
+		Iter( TokenQueue& pQueue )
+			: queue(&pQueue)
+			, position(pQueue.removed + pQueue.first)
+		{}
+
+		bool isSet() const {
+			return notNull(queue);
+		}
+
+		Token& operator*() {
+			return queue->tokens[position - queue->removed];
+		}
+
+		Token& getItem() {
+			return queue->tokens[position - queue->removed];
+		}
+
+		bool prev() {
+			if ( position <= queue->removed + queue->first )
+				return false;
+			--position;
+			return true;
+		}
+
+		bool next() {
+			if ( position + 1 >= queue->removed + queue->end )
+				return false;
+			++position;
+			return true;
+		}
+
+		void reset() {
+			position = queue->removed + queue->first;
+		}
+
+		bool atEnd() const {
+			return ! queue->has() || position + 1 == queue->removed + queue->end;
+		}
+
+		bool has() const {
+			return queue->has();
+		}
+	};
+
+	TokenQueue();
+	~TokenQueue();
+
+	Iter start() {
+		return Iter(*this);
 	}
 
-	// returning an address prevents deleting the pointer
-	Task& getTask() { return (Task&)*task; }
+	bool has() const {
+		return end > first;
+	}
 
-	bool areSameTask(Task* pOther) {
-		return task == pOther;
+	uint size() const {
+		return end - first;
 	}
+
+	void push_back( const Token& pToken );
+
+	// Removes the last token
+	void pop();
+
+	void clear();
+
+	// Removes all tokens PRIOR to the given iterator
+	void removeUpTo( const Iter& pStop );
 };
 
-typedef List<Token>			TokenQueue;
-typedef List<Token>::Iter	TokenQueueIter;
+typedef TokenQueue::Iter	TokenQueueIter;
 
 //typedef List<String> 			VarAddress;
 //typedef List<String>::Iter 		VarAddressIter;
@@ -1194,7 +1754,7 @@ class CopyBodyOpcodeException {};
 class InvalidBodyOpcodeAccess {};
 class NullGotoOpcodeException {};
 
-//---------- Predeclarations for OpcodeContainer and Opcode
+//---------- Predeclarations for OpStrand and Opcode
 
 class Body; // pre-declaration
 
@@ -1202,6 +1762,45 @@ class Opcode; // pre-declaration
 
 //-----------
 
+class ForeignFunc; // predeclaration
+class Variable; // predeclaration
+
+//! Frame Layout
+/*
+	The names of the local variables of a compiled function body, in the order of their
+	slots in the stack frames that run the body. The first slots are always "this" and "super".
+	Names not in the layout are kept in the scope of the stack frame.
+*/
+class FrameLayout : public Ref {
+	Symbol*  names;
+	UInteger  count;
+	UInteger  capacity;
+
+public:
+	// Slot of names that are not in the layout
+	static const UInteger NoSlot = 0xffffffff;
+
+	FrameLayout();
+
+	~FrameLayout();
+
+	// Adds the name if it is not in the layout. Returns its slot.
+	UInteger add( const Symbol&  pName );
+
+	// Returns the slot of the given name or NoSlot
+	UInteger find( const Symbol&  pName ) const;
+
+	UInteger size() const {
+		return count;
+	}
+
+#ifdef COPPER_USE_DEBUG_NAMES
+	virtual const char* getDebugName() const {
+		return "FrameLayout";
+	}
+#endif
+};
+
 //! Address of a Variable
 /*
 	Addresses are constant after being built and are only iterated over from start-to-finish,
@@ -1210,22 +1809,51 @@ class Opcode; // pre-declaration
 class VarAddress : public Ref {
 
 	struct Node {
-		const String data;
+		const Symbol data;
 		Node* post;
 
-		Node( const String&  pData )
+		// Inline cache of the member variable of this name (or, for the first name, of the global variable).
+		// Only valid while the scope it was found in has the same stamp. (See Scope::getStamp.)
+		Variable* cachedVariable;
+		uint cachedScopeStamp;
+
+		Node( const Symbol&  pData )
 			: data(pData)
 			, post(REAL_NULL)
+			, cachedVariable(REAL_NULL)
+			, cachedScopeStamp(0)
 		{}
+
+#ifdef COPPER_USE_SLAB_ALLOCATOR
+		static void* operator new( size_t  pSize ) {
+			return util::SlabAllocator::allocate(pSize);
+		}
+
+		static void operator delete( void*  pBlock, size_t  pSize ) {
+			util::SlabAllocator::release(pBlock, pSize);
+		}
+#endif
 	};
 
 	Node*  head;
 	Node*  tail;
 
+	// Cached symbol of the complete dotted name
+	mutable Symbol  fullName;
+	mutable bool  hasFullName;
+
 public:
 	// Optimization: track when value is a system function name
 	SystemFunction::Value sysFuncValue;
 
+	// Optimization: cached result of looking up this address in an engine's foreign function table.
+	// Only valid while foreignFuncStamp matches the stamp of the table. (See Engine::findForeignFunction.)
+	mutable ForeignFunc* foreignFunc;
+	mutable UInteger foreignFuncStamp;
+
+	// Optimization: slot of the first name in the frame layout of the body holding this address
+	UInteger localSlot;
+
 	// For access only
 	class Iterator {
 		friend VarAddress;
@@ -1266,7 +1894,7 @@ public:
 			return notNull(curr);
 		}
 
-		const String&
+		const Symbol&
 		get() const {
 #ifdef COPPER_STRICT_CHECKS
 			if ( !curr )
@@ -1279,19 +1907,44 @@ public:
 		reset() {
 			curr = start;
 		}
+
+		// Returns the cached variable for the current name if it was found in a scope
+		// with the given stamp. Otherwise, returns REAL_NULL.
+		Variable*
+		getCachedVariable( uint  pScopeStamp ) const {
+			if ( curr->cachedScopeStamp == pScopeStamp )
+				return curr->cachedVariable;
+			return REAL_NULL;
+		}
+
+		void
+		setCachedVariable( Variable*  pVariable, uint  pScopeStamp ) {
+			curr->cachedVariable = pVariable;
+			curr->cachedScopeStamp = pScopeStamp;
+		}
 	};
 
 
 	VarAddress()
 		: head(REAL_NULL)
 		, tail(REAL_NULL)
+		, fullName()
+		, hasFullName(false)
 		, sysFuncValue(SystemFunction::_unset)
+		, foreignFunc(REAL_NULL)
+		, foreignFuncStamp(0)
+		, localSlot(FrameLayout::NoSlot)
 	{}
 
 	VarAddress( const VarAddress&  pOther )
 		: head(REAL_NULL)
 		, tail(REAL_NULL)
+		, fullName(pOther.fullName)
+		, hasFullName(pOther.hasFullName)
 		, sysFuncValue(SystemFunction::_unset)
+		, foreignFunc(REAL_NULL)
+		, foreignFuncStamp(0)
+		, localSlot(FrameLayout::NoSlot)
 	{
 		if ( isNull(pOther.head) )
 			return;
@@ -1331,8 +1984,15 @@ public:
 		return false;
 	}
 
+	// Indicates the address is only the name of a built-in function, so it can be called directly
+	bool
+	isSysFunc() const {
+		return sysFuncValue != SystemFunction::_unset && hasOne();
+	}
+
 	void
-	push_back( const String&  part ) {
+	push_back( const Symbol&  part ) {
+		hasFullName = false;
 		if ( !tail ) {
 			tail = new Node( part );
 			head = tail;
@@ -1342,7 +2002,7 @@ public:
 		}
 	}
 
-	const String&
+	const Symbol&
 	first() const {
 #ifdef COPPER_STRICT_CHECKS
 		if ( !head )
@@ -1351,6 +2011,25 @@ public:
 		return head->data;
 	}
 
+	// Returns the cached global variable of the first name if it was found in a global scope
+	// with the given stamp. Otherwise, returns REAL_NULL.
+	Variable*
+	getCachedGlobal( uint  pScopeStamp ) const {
+		if ( head->cachedScopeStamp == pScopeStamp )
+			return head->cachedVariable;
+		return REAL_NULL;
+	}
+
+	void
+	setCachedGlobal( Variable*  pVariable, uint  pScopeStamp ) const {
+		head->cachedVariable = pVariable;
+		head->cachedScopeStamp = pScopeStamp;
+	}
+
+	// Returns the symbol for the complete address (names joined with the member link)
+	const Symbol&
+	getFullName() const;
+
 	Iterator
 	iterator() const {
 		return Iterator(head);
@@ -1361,7 +2040,7 @@ public:
 		std::printf("[DEBUG: Address = ");
 		Iterator i = iterator();
 		while ( ! i.atEnd() ) {
-			std::printf("%s ", i.get().c_str());
+			std::printf("%s ", i.get().getName().c_str());
 			i.next();
 		}
 		std::printf("\n");
@@ -1369,34 +2048,6 @@ public:
 #endif
 };
 
-//----------
-// Moved from AFTER Opcode
-
-class OpcodeContainer {
-	// DO NOT SHARE
-	Opcode* code;
-
-public:
-	explicit OpcodeContainer( Opcode* pCode );
-
-	OpcodeContainer( const OpcodeContainer& pOther ); // Used only for transmission in lists
-
-	~OpcodeContainer();
-
-	//const Opcode*
-	Opcode* // non-const required for referencing addresses
-	getOp();
-
-	//static OpcodeContainer
-	//indie( Opcode* pCode );
-};
-
-//typedef List<OpcodeContainer> OpStrand;
-//typedef List<OpcodeContainer>::Iter OpStrandIter;
-
-struct OpStrand : public List<OpcodeContainer>, public Ref {};
-typedef OpStrand::Iter	OpStrandIter;
-
 //----------
 
 struct Opcode : public Ref {
@@ -1410,11 +2061,21 @@ struct Opcode : public Ref {
 		FuncBuild_end,
 
 		FuncFound_access,
+		FuncFound_accessLocal, // Quickened FuncFound_access of a variable in a frame slot
+		FuncFound_accessGlobal, // Quickened FuncFound_access of a global variable
 		FuncFound_assignment,
 		FuncFound_pointerAssignment,
 		FuncFound_call,
+		FuncFound_callDirect, // Quickened FuncFound_call of a user function without arguments
 		FuncFound_setParam,
 		FuncFound_finishCall,
+		FuncFound_finishTailCall, // Call whose result is the result of the body running it
+		FuncFound_finishUserCall, // Quickened FuncFound_finishCall of a user function
+		FuncFound_finishUserTailCall, // Quickened FuncFound_finishTailCall of a user function
+
+		SysCall_setParam,
+		SysCall,
+		SysCall_condition, // SysCall whose result is the condition of the ConditionalGoto after its Terminal
 
 		Terminal,
 		Goto,
@@ -1434,6 +2095,7 @@ struct Opcode : public Ref {
 	enum DataType {
 		ODT_Unset=0,
 		ODT_Name,
+		ODT_Symbol,
 		ODT_Address,
 		ODT_Integer,
 		ODT_Decimal,
@@ -1448,12 +2110,13 @@ protected:
 	// Non-trivial destructors
 	String name;
 	VarAddress* address;
+	Symbol symbol;
 	union {
 		Body*			body;
-		//CodeIndex		codeIndex; // or GotoWrap
-		OpStrandIter*	target;
+		int				jump; // Offset from this opcode to the target opcode
 		Decimal			decimal;
 		Integer			integer;
+		UInteger		argCount; // For SysCall
 	} data;
 
 	/*
@@ -1467,6 +2130,8 @@ public:
 
 	Opcode( Opcode::Type pType, const String&  pStrValue, bool  onAddress );
 
+	Opcode( Opcode::Type pType, const Symbol&  pSymbol, bool  onAddress );
+
 	//Opcode( Opcode::Type pType, const VarAddress&  pAddress );
 	Opcode( Opcode::Type pType, VarAddress*  pAddress );
 
@@ -1479,8 +2144,11 @@ public:
 
 	void setType( Opcode::Type pType );
 
+	DataType
+	getDataType() const;
+
 	void
-	appendAddressData( const String&  pString );
+	appendAddressData( const Symbol&  pSymbol );
 
 	//const VarAddress*
 	//getAddressData() const;
@@ -1488,10 +2156,14 @@ public:
 	VarAddress*
 	getAddressData();
 
-	// Used for function parameters and so forth
+	// Used for strings
 	String
 	getNameData() const;
 
+	// Used for function parameters and member names
+	const Symbol&
+	getSymbolData() const;
+
 	void
 	setIntegerData( Integer value );
 
@@ -1508,46 +2180,178 @@ public:
 	addToken( const Token& pToken );
 
 	Body*
-	getBody() const;
+	getBody() const;
+
+	int
+	getJump() const;
+
+	void
+	setArgCount( UInteger  count );
+
+	UInteger
+	getArgCount() const;
+};
+
+class BadOpcodeException {
+	const Opcode::Type v;
+	
+public:
+	BadOpcodeException(const Opcode::Type code)
+		: v(code)
+	{}
+
+	Opcode::Type getOpcodeType() const {
+		return v;
+	}
+};
+
+//! Instruction
+/*
+	The packed form of an Opcode that is stored in an OpStrand and executed.
+	The operand is a jump offset (for gotos), a symbol ID (for parameter and member names),
+	or an index into the constant pool of the OpStrand holding the instruction.
+	SysCall also stores its argument count in the otherwise-unused padding.
+*/
+struct Instruction {
+	unsigned char  type; // Opcode::Type
+	unsigned char  dtype; // Opcode::DataType
+	unsigned short  argCount; // For SysCall
+	int  operand;
+
+	Opcode::Type
+	getType() const {
+		return (Opcode::Type)type;
+	}
+
+	int
+	getJump() const {
+		return operand;
+	}
+
+	bool
+	isJump() const {
+		return type == Opcode::Goto || type == Opcode::ConditionalGoto;
+	}
+
+	Symbol
+	getSymbolData() const {
+		return Symbol::fromId( (UInteger)operand );
+	}
+};
+
+// Instruction data that does not fit in the operand
+union OpConstant {
+	String*		string;
+	VarAddress*	address;
+	Body*		body;
+	Object*		literal; // Number created by the instruction. Shared by every run, so it is never modified.
+};
+
+//! Opcode Strand
+/*
+	A contiguous array of instructions and the pool of constants they use.
+	Opcodes are only used for building: Adding one to the strand packs it into an instruction,
+	so the opcode itself is not kept.
+	Jumps (Goto and ConditionalGoto) store offsets relative to their own position, so the strand
+	can grow or have its already-run beginning removed without invalidating them.
+	Bodies are compacted once compiled. Afterwards, only the types of instructions are changed:
+	Quickening (see Engine::quickenAccess(), quickenFoundCall(), and quickenCall()) rewrites an
+	instruction in place with setType(), keeping its operand, so the size and jumps of the strand
+	are unchanged. A quickened instruction is checked each time it runs: the foreign function stamp
+	of its address must be current and the frame slot (or the global, cached by scope stamp) must
+	still hold the variable. Otherwise, it runs as the general opcode, which quickens it again.
+*/
+class OpStrand : public Ref {
+	Instruction*  codes;
+	uint  count;
+	uint  capacity;
+	OpConstant*  constants;
+	uint  constantCount;
+	uint  constantCapacity;
+
+	uint addConstant( const OpConstant&  pConstant );
+	void releaseConstant( const Instruction&  pCode );
+
+public:
+	OpStrand();
+
+	~OpStrand();
+
+	// Packs and adds the given opcode. Returns the index of the instruction.
+	uint push_back( Opcode* pCode );
+
+	const Instruction&
+	get( uint pIndex ) const {
+		return codes[pIndex];
+	}
+
+	uint
+	size() const {
+		return count;
+	}
+
+	VarAddress*
+	getAddressData( const Instruction&  pCode ) const {
+		return constants[pCode.operand].address;
+	}
+
+	const String&
+	getNameData( const Instruction&  pCode ) const {
+		return *(constants[pCode.operand].string);
+	}
+
+	Object*
+	getLiteral( const Instruction&  pCode ) const {
+		return constants[pCode.operand].literal;
+	}
+
+	Body*
+	getBody( const Instruction&  pCode ) const {
+		return constants[pCode.operand].body;
+	}
 
-	void
-	setTarget( const OpStrandIter pTarget );
+	// Sets the jump offset of the goto at the given index so that it lands on the target index
+	void setJump( uint pGotoIndex, uint pTargetIndex );
 
-	OpStrandIter&
-	getOpStrandIter();
-};
+	// Changes the type of the instruction at the given index. The new type must use the same data.
+	void setType( uint pIndex, Opcode::Type pType );
 
-class BadOpcodeException {
-	const Opcode::Type v;
-	
-public:
-	BadOpcodeException(const Opcode::Type code)
-		: v(code)
-	{}
+	// Removes the given number of instructions, starting at the given index.
+	// Jumps that landed on the removed instructions land on the instruction after them.
+	void removeRange( uint pStart, uint pCount );
 
-	Opcode::Type getOpcodeType() const {
-		return v;
-	}
+	// Replaces the instructions from pStart to pEnd (inclusive) with one that creates the given value.
+	// Only booleans, strings, integers, and decimals can be created. Returns false for other values.
+	bool replaceWithValue( uint pStart, uint pEnd, Object* pValue );
+
+	// Removes all instructions before the given index
+	void removeUpTo( uint pIndex );
+
+	// Releases unused capacity
+	void compact();
 };
 
 class OpStrandContainer {
 	OpStrand* s;
-	OpStrandIter i; // Should be const but stuff may act through it. Find out what does.
+	uint pc; // Index of the current opcode
 	bool is_const;
+	uint argBase; // Size of the engine's built-in call argument stack when this strand started
 
 public:
-	OpStrandContainer( OpStrand* strand, bool immutable = false )
+	OpStrandContainer( OpStrand* strand, bool immutable = false, uint pArgBase = 0 )
 		: s(strand)
-		, i(strand->start())
+		, pc(0)
 		, is_const(immutable)
+		, argBase(pArgBase)
 	{
 		s->ref();
 	}
 
 	OpStrandContainer(const OpStrandContainer& pOther)
 		: s(pOther.s)
-		, i(pOther.i)
+		, pc(pOther.pc)
 		, is_const(pOther.is_const)
+		, argBase(pOther.argBase)
 	{
 		s->ref();
 	}
@@ -1556,22 +2360,179 @@ public:
 		s->deref();
 	}
 
-	OpStrandIter& getCurrOp() {
-		return i;
+	bool has() const {
+		return s->size() > 0;
+	}
+
+	const Instruction& getCurrOp() const {
+		return s->get(pc);
+	}
+
+	bool next() {
+		if ( pc + 1 >= s->size() )
+			return false;
+		++pc;
+		return true;
+	}
+
+	// Moves by the given offset. Used by gotos.
+	void jump( int offset ) {
+		pc = (uint)((int)pc + offset);
+	}
+
+	void reset() {
+		pc = 0;
+	}
+
+	void makeLast() {
+		if ( s->size() > 0 )
+			pc = s->size() - 1;
+	}
+
+	bool atEnd() const {
+		return pc + 1 >= s->size();
 	}
 
 	OpStrand* getCurrStrand() {
 		return s;
 	}
 
+	uint getIndex() const {
+		return pc;
+	}
+
+	uint getArgBase() const {
+		return argBase;
+	}
+
 	void removeAllUpToCurrentCode() {
-		if (!is_const)
-			s->removeUpTo(i);
+		if (!is_const) {
+			s->removeUpTo(pc);
+			pc = 0;
+		}
+	}
+};
+
+//! Opcode Strand Stack
+/*
+	A contiguous stack of the strands being run. The first few containers are stored inline,
+	so the temporary stacks of foreign function calls never allocate.
+	Growing the stack moves the containers, so pointers to them must be fetched again after a push.
+	The iterator behaves like that of List.
+*/
+class OpStrandStack {
+	void*  inlineStorage[ CU_OPSTRAND_STACK_INLINE_SIZE
+		* ( (sizeof(OpStrandContainer) + sizeof(void*) - 1) / sizeof(void*) ) ];
+	OpStrandContainer*  items;
+	uint  count;
+	uint  capacity;
+
+	void grow() {
+		OpStrandContainer* newItems = (OpStrandContainer*) ::operator new( sizeof(OpStrandContainer) * capacity * 2 );
+		uint i = 0;
+		for (; i < count; ++i) {
+			new ((void*)(newItems + i)) OpStrandContainer(items[i]);
+			items[i].~OpStrandContainer();
+		}
+		if ( (void*)items != (void*)inlineStorage )
+			::operator delete( (void*)items );
+		items = newItems;
+		capacity *= 2;
+	}
+
+	// Disallow copies
+	OpStrandStack( const OpStrandStack& );
+	OpStrandStack& operator= ( const OpStrandStack& );
+
+public:
+	class Iter {
+		OpStrandStack*  stack;
+		uint  index;
+
+	public:
+		Iter( OpStrandStack&  pStack, uint  pIndex )
+			: stack(&pStack)
+			, index(pIndex)
+		{}
+
+		bool has() const {
+			return stack->count > 0;
+		}
+
+		bool next() {
+			if ( index + 1 >= stack->count )
+				return false;
+			++index;
+			return true;
+		}
+
+		void makeLast() {
+			if ( stack->count > 0 )
+				index = stack->count - 1;
+		}
+
+		bool atStart() const {
+			return index == 0;
+		}
+
+		OpStrandContainer& operator* () {
+			return stack->items[index];
+		}
+
+		OpStrandContainer* operator-> () {
+			return stack->items + index;
+		}
+	};
+
+	OpStrandStack()
+		: items((OpStrandContainer*)(void*)inlineStorage)
+		, count(0)
+		, capacity(CU_OPSTRAND_STACK_INLINE_SIZE)
+	{}
+
+	~OpStrandStack() {
+		clear();
+		if ( (void*)items != (void*)inlineStorage )
+			::operator delete( (void*)items );
+	}
+
+	void push_back( const OpStrandContainer&  pContainer ) {
+		if ( count == capacity )
+			grow();
+		new ((void*)(items + count)) OpStrandContainer(pContainer);
+		++count;
+	}
+
+	void pop() {
+		if ( count > 0 ) {
+			--count;
+			items[count].~OpStrandContainer();
+		}
+	}
+
+	void clear() {
+		while ( count > 0 )
+			pop();
+	}
+
+	uint size() const {
+		return count;
+	}
+
+	bool has() const {
+		return count > 0;
+	}
+
+	Iter start() {
+		return Iter(*this, 0);
+	}
+
+	Iter end() {
+		return Iter(*this, count > 0 ? count - 1 : 0);
 	}
 };
 
-typedef List<OpStrandContainer> OpStrandStack;
-typedef List<OpStrandContainer>::Iter OpStrandStackIter;
+typedef OpStrandStack::Iter OpStrandStackIter;
 
 // Attempting to use or access a strand that is null
 class EmptyOpstrandException {};
@@ -1598,6 +2559,7 @@ private:
 	State state;
 	TokenQueue tokens;
 	OpStrand* codes;
+	FrameLayout* layout;
 
 public:
 	Body();
@@ -1613,6 +2575,9 @@ public:
 
 	OpStrand* getOpcodeStrand();
 
+	// Local variable slots of the frames running this body. Only complete once compiled.
+	FrameLayout* getLayout();
+
 	bool isEmpty() const;
 
 #ifdef COPPER_USE_DEBUG_NAMES
@@ -1623,6 +2588,12 @@ public:
 
 protected:
 	bool compile_internal(Engine* engine);
+
+	void buildLayout();
+
+	void markTailCalls();
+
+	bool isTailPosition( uint pIndex ) const;
 };
 
 
@@ -1630,23 +2601,31 @@ protected:
 
 class Scope; // predeclaration - Not enough. Function methods need to be in a separate CPP file.
 
+/*
+	Functions that only hold data (such as those created by "x = 5") never need a body or members,
+	so both the body and the persistent scope are created only when first needed.
+	An empty body pointer means the same as an empty body.
+*/
 struct Function : public Ref {
 	bool constantReturn; // If this function always returns the same, static value (allows skipping run)
-	RefPtr<Body> body;
-	List<String> params; // Should probably be a pointer so it can be easily set
+	RefPtr<Body> body; // May be null
+	List<Symbol> params; // Should probably be a pointer so it can be easily set
 	RefPtr<Object> result; // Used only for constant-return functions
 
 private:
-	Scope* persistentScope;
+	Scope* persistentScope; // Created on first request
+
+	void copyScopeFrom( const Function& other );
 
 public:
 	Function();
 	Function(const Function& pOther); // Do NOT use directly. Use set() for copying.
 	~Function();
 	Function& operator=(const Function& pOther);
-	Scope& getPersistentScope();
+	Scope& getPersistentScope(); // Creates the scope if it does not exist
+	bool hasPersistentScope() const; // Use to avoid creating the scope when only reading members
 	void set( Function& other, bool copyScope=true );
-	void addParam( const String pName );
+	void addParam( const Symbol& pName );
 
 #ifdef COPPER_USE_DEBUG_NAMES
 	virtual const char* getDebugName() const {
@@ -2024,13 +3003,38 @@ public:
 	A base object for all numbers, allowing interaction
 */
 struct NumericObject : public Object {
+protected:
+	bool constant; // Shared by every run of the opcode that created it, so it must not be modified
+	ObjectType::Value numberType; // Integer or DecimalNum for the engine's own number classes
+
+	// For the engine's own number classes
+	explicit NumericObject( ObjectType::Value  pNumberType );
 
+public:
 	static const ObjectType::Value object_type = ObjectType::Numeric;
 
 	NumericObject();
 
 	virtual ~NumericObject();
 
+	// Identifies IntegerObject and DecimalNumObject without virtual calls.
+	// Returns ObjectType::Numeric for all other number classes.
+	ObjectType::Value
+	getNumberType() const {
+		return numberType;
+	}
+
+	void
+	setConstant() {
+		constant = true;
+	}
+
+	// setValue() does nothing to constant numbers
+	bool
+	isConstant() const {
+		return constant;
+	}
+
 	static const char*
 	StaticTypeName() {
 		return "number";
@@ -2135,6 +3139,18 @@ iszero(
 	Decimal		p
 );
 
+// Value of the given number. Avoids virtual calls for IntegerObject and DecimalNumObject.
+Integer unboxInteger( const NumericObject& );
+Decimal unboxDecimal( const NumericObject& );
+
+// Arithmetic used by the number classes.
+// These clamp the result when ENABLE_COPPER_NUMERIC_BOUNDS_CHECKS is defined.
+Integer integerAdd( Integer, Integer );
+Integer integerSubtract( Integer, Integer );
+Integer integerMultiply( Integer, Integer );
+Integer integerDivide( Integer, Integer );
+Decimal decimalDivide( Decimal, Decimal );
+
 
 /*
 	Object type represeting integers
@@ -2146,19 +3162,19 @@ class IntegerObject : public NumericObject {
 public:
 	//! cstor
 	IntegerObject()
-		: NumericObject()
+		: NumericObject(ObjectType::Integer)
 		, value(0)
 	{}
 
 	//! cstor
 	IntegerObject( Integer newValue )
-		: NumericObject()
+		: NumericObject(ObjectType::Integer)
 		, value ( newValue )
 	{}
 
 	//! cstor
 	IntegerObject( const IntegerObject& other )
-		: NumericObject()
+		: NumericObject(ObjectType::Integer)
 		, value( other.value )
 	{}
 
@@ -2194,7 +3210,8 @@ public:
 
 	void
 	setValue( Integer newValue ) {
-		value = newValue;
+		if ( ! constant )
+			value = newValue;
 	}
 
 	virtual void
@@ -2248,19 +3265,19 @@ class DecimalNumObject : public NumericObject {
 public:
 	//! cstor
 	DecimalNumObject()
-		: NumericObject()
+		: NumericObject(ObjectType::DecimalNum)
 		, value(0)
 	{}
 
 	//! cstor
 	DecimalNumObject( Decimal newValue )
-		: NumericObject()
+		: NumericObject(ObjectType::DecimalNum)
 		, value ( newValue )
 	{}
 
 	//! cstor
 	DecimalNumObject( const DecimalNumObject& other )
-		: NumericObject()
+		: NumericObject(ObjectType::DecimalNum)
 		, value( other.value )
 	{}
 
@@ -2296,7 +3313,8 @@ public:
 
 	void
 	setValue( Decimal newValue ) {
-		value = newValue;
+		if ( ! constant )
+			value = newValue;
 	}
 
 	virtual void
@@ -2366,12 +3384,22 @@ class ListObject : public Object, public AppendObjectInterface {
 		Node* prior;
 		Node* post;
 
+		// Returns the object to hold for pItem, already referenced.
+		// Number literals are shared by every run of their opcode, so the list holds a copy,
+		// which ++ and -- can then change in place.
+		static Object*
+		refForStorage( Object*  pItem ) {
+			if ( pItem->getType() == ObjectType::Numeric && ((NumericObject*)pItem)->isConstant() )
+				return pItem->copy();
+			pItem->ref();
+			return pItem;
+		}
+
 		Node( Object* pItem )
-			: item( pItem )
+			: item( refForStorage(pItem) )
 			, prior( REAL_NULL )
 			, post( REAL_NULL )
 		{
-			item->ref();
 			if ( item->getType() == ObjectType::Function )
 				((FunctionObject*)item)->own(this);
 		}
@@ -2422,11 +3450,10 @@ class ListObject : public Object, public AppendObjectInterface {
 					((FunctionObject*)item)->disown(this);
 				item->deref();
 			}
-			item = pItem;
+			item = pItem ? refForStorage(pItem) : REAL_NULL;
 			if ( item ) {
 				if ( item->getType() == ObjectType::Function )
 					((FunctionObject*)item)->own(this);
-				item->ref();
 			}
 		}
 
@@ -2717,6 +3744,10 @@ public:
 	ForeignFunc* getForeignFunction() {
 		return data.raw();
 	}
+
+	void set(ForeignFunc* func) {
+		data.set(func);
+	}
 };
 
 //-------------------
@@ -2758,10 +3789,11 @@ class NonExistentScopeTableException {};
 #endif
 
 class Scope : public Ref {
-	RobinHoodHash<RefVariableStorage>* robinHoodTable;
+	RobinHoodHash<RefVariableStorage, Symbol>* robinHoodTable;
+	uint stamp; // Unique among all scopes. Renewed whenever a variable is added or replaced.
 
 protected:
-	void copyAsgnFromHashTable( RobinHoodHash<RefVariableStorage>& pTable );
+	void copyAsgnFromHashTable( RobinHoodHash<RefVariableStorage, Symbol>& pTable );
 
 public:
 	Scope( UInteger pTableSize = CU_FUNCTION_SCOPE_SIZE );
@@ -2782,25 +3814,27 @@ public:
 
 	Scope& operator = (Scope& pOther);
 
-	bool variableExists(const String& pName);
+	bool variableExists(const Symbol& pName);
+	bool variableExists(const String& pName); // Does not intern the name
 
 	// Adds an empty variable and returns a pointer to it
-	Variable* addVariable(const String& pName);
+	Variable* addVariable(const Symbol& pName);
 
 	// Gets the variable, creating it if it does not exist
-	void getVariable(const String& pName, Variable*& pVariable);
+	void getVariable(const Symbol& pName, Variable*& pVariable);
 
 	// Looks for the variable. If the function exists, it saves it to storage.
 	// Returns "true" if the variable was found, false otherwise.
 	// Shouldn't the string here be const?
-	bool findVariable(const String& pName, Variable*& pStorage);
+	bool findVariable(const Symbol& pName, Variable*& pStorage);
+	bool findVariable(const String& pName, Variable*& pStorage); // Does not intern the name
 
 	// Sets the variable, creating the variable if it does not exist
 	// The pReuseStorage option may be ignored if the FunctionObject is not owned
-	void setVariable(const String& pName, Variable* pSourceVariable, bool pReuseStorage);
+	void setVariable(const Symbol& pName, Variable* pSourceVariable, bool pReuseStorage);
 
 	// Sets the variable, creating the variable if it does not exist
-	void setVariableFrom(const String& pName, Object* pObject, bool pReuseStorage);
+	void setVariableFrom(const Symbol& pName, Object* pObject, bool pReuseStorage);
 
 	// Appends to the given list all the names of the members in this scope.
 	// Could be turned into List<Object> and return object strings but there is no built-in list class.
@@ -2812,6 +3846,12 @@ public:
 	// Number of occupied storage slots / actual Variables (there may be more storage allocated)
 	UInteger occupancy();
 
+	// While the stamp is unchanged, the variables returned by this scope remain valid
+	// and no names have been added. Used by the inline caches of addresses.
+	uint getStamp() const {
+		return stamp;
+	}
+
 #ifdef COPPER_USE_DEBUG_NAMES
 	virtual const char* getDebugName() const {
 		return "Scope";
@@ -2841,31 +3881,82 @@ struct PrintScopeObjectNames : public AppendObjectInterface {
 // Pre-declaration
 class Stack;
 
-class StackFrame : public Ref {
+//! Stack Frame
+/*
+	Frames of compiled function bodies keep the variables named in the body's frame layout
+	in an array of slots (created when first used). Other names are kept in the scope,
+	which is only created when needed. Names in the layout are never stored in the scope.
+	Frames are created and destroyed only by the Stack, which places each frame and its slots
+	in its own memory regions.
+*/
+class StackFrame {
 	friend Stack;
 
 	StackFrame* parent; // Set by Stack
+	UInteger region; // Index of the Stack memory region holding this frame
 	Scope* scope;
 	VarAddress* address;
+	FrameLayout* layout;
+	Variable** slots;
+	UInteger slotCount;
 
-public:
-	StackFrame( VarAddress* pAddress );
+	// Slot storage must have room for one pointer per name in the layout
+	StackFrame( VarAddress* pAddress, FrameLayout* pLayout, Variable** pSlotStorage );
 
-	StackFrame( const StackFrame& pOther );
+	StackFrame( const StackFrame& pOther ); // Not implemented
 
 	~StackFrame();
 
+public:
+
 	void
 	replaceScope();
 
+	// Scope of the names that have no slot
 	Scope&
 	getScope();
 
 	VarAddress*
 	getAddress();
 
+	// Looks for the variable. Returns "true" if the variable was found, false otherwise.
+	bool
+	findVariable( const Symbol&  pName, Variable*&  pStorage );
+
+	// Looks for the variable of the first name of the address, using its slot if it has one.
+	bool
+	findVariable( const VarAddress&  pAddress, Variable*&  pStorage );
+
+	// Returns the slot of the first name of the address or REAL_NULL if it has no slot in this frame.
+	Variable**
+	getSlot( const VarAddress&  pAddress ) {
+		if ( pAddress.localSlot < slotCount )
+			return slots + pAddress.localSlot;
+		return REAL_NULL;
+	}
+
+	// Gets the variable, creating it if it does not exist
+	void
+	getVariable( const Symbol&  pName, Variable*&  pVariable );
+
+	// Gets the variable of the first name of the address, creating it if it does not exist
+	void
+	getVariable( const VarAddress&  pAddress, Variable*&  pVariable );
+
+	// Adds an empty variable
+	void
+	addVariable( const Symbol&  pName );
+
+	// Sets the variable, creating the variable if it does not exist
+	void
+	setVariable( const Symbol&  pName, Variable*  pSourceVariable, bool  pReuseStorage );
+
+	// Sets the variable, creating the variable if it does not exist
+	void
+	setVariableFrom( const Symbol&  pName, Object*  pObject, bool  pReuseStorage );
+
 #ifdef COPPER_USE_DEBUG_NAMES
-	virtual const char* getDebugName() const {
+	const char* getDebugName() const {
 		return "StackFrame";
 	}
 #endif
@@ -2878,7 +3969,23 @@ enum StackPopReturn {
 };
 
 // Stack class
+/*
+	Frames (and their slots) are carved from large memory regions by moving a pointer forward
+	and are released by moving it back, so calls do not allocate once the regions exist.
+	A frame that does not fit in the rest of the current region starts the next region.
+	Regions are kept until the stack is destroyed.
+*/
 class Stack {
+	struct Region {
+		char*  start;
+		char*  end;
+	};
+
+	Region*  regions;
+	UInteger  regionCount;
+	UInteger  currRegion;
+	char*  nextFree; // Next unused byte of the current region
+
 	UInteger  size;
 	// Singly Linked List from top-to-bottom
 	StackFrame*  bottom;
@@ -2887,6 +3994,10 @@ class Stack {
 	// Bottom frame name
 	VarAddress*  globalName;
 
+	StackFrame* createFrame( VarAddress* pAddress, FrameLayout* pLayout );
+	void moveToNextRegion( uint pBytes );
+	void destroyTop();
+
 public:
 	Stack();
 #ifdef COMPILE_COPPER_FOR_C_PLUS_PLUS_11
@@ -2903,9 +4014,15 @@ public:
 	StackFrame& getBottom();
 	StackFrame& getTop();
 	UInteger getCurrLevel();
+
+	// Whether the global frame is the top frame
+	bool isTopGlobal() const {
+		return top == bottom;
+	}
+
 	StackPopReturn pop();
-	void push( VarAddress* pAddress );
-	void push( StackFrame* );
+	// Adds a frame and returns it. If the stack is empty, the global frame is added instead.
+	StackFrame& push( VarAddress* pAddress, FrameLayout* pLayout = REAL_NULL );
 	void print( Logger* );
 };
 
@@ -2997,8 +4114,8 @@ struct ParseResult {
 
 class ParserContext {
 	TokenQueue* tokenSource;
-	TokenQueueIter* currToken;
-	TokenQueueIter* lastUsedToken;
+	TokenQueueIter currToken; // Unset until there is a source
+	TokenQueueIter lastUsedToken; // Unset until a token is used
 
 public:
 	OpStrand* outputStrand;
@@ -3022,7 +4139,7 @@ public:
 	bool moveToFirstUnusedToken();
 
 	// Gets the next token
-	Token peekAtToken();
+	const Token& peekAtToken();
 	bool moveToNextToken();
 	bool moveToPreviousToken();
 
@@ -3032,11 +4149,11 @@ public:
 	// Deletes tokens that have been used upto the current one
 	void clearUsedTokens();
 
-	// Add new operation
-	void addNewOperation( Opcode* newOp );
+	// Add new operation. Returns its index in the output strand.
+	uint addNewOperation( Opcode* newOp );
 
-	// Add operation that has already been reference-counted
-	void addOperation( Opcode* op );
+	// Add operation that has already been reference-counted. Returns its index in the output strand.
+	uint addOperation( Opcode* op );
 
 	// TODO:
 	// Replace addNewOperation() and addOperation() with methods that handle ALL possible
@@ -3080,7 +4197,7 @@ struct FuncBuildParseTask : public ParseTask {
 		};
 	};
 	State::Value state;
-	String paramName;
+	Symbol paramName;
 
 	FuncBuildParseTask(State::Value s)
 		: ParseTask(ParseTask::FuncBuild)
@@ -3092,10 +4209,122 @@ struct FuncBuildParseTask : public ParseTask {
 typedef List<Object*>			ArgsList;
 typedef List<Object*>::Iter		ArgsIter;
 
+//! Arguments Buffer
+/*
+	A contiguous array of function-call arguments. The first few are stored inline,
+	so most calls never allocate. Like ArgsList, it does not reference-count its contents.
+	The iterator behaves like that of List: has() is true for a non-empty buffer and next()
+	stays on the last item when it returns false.
+*/
+class ArgsBuffer {
+	Object*  inlineItems[CU_ARGS_INLINE_SIZE];
+	Object**  items;
+	uint  count;
+	uint  capacity;
+
+	void grow() {
+		Object** newItems = new Object*[capacity * 2];
+		std::memcpy( (void*)newItems, (void*)items, sizeof(Object*) * count );
+		if ( items != inlineItems )
+			delete[] items;
+		items = newItems;
+		capacity *= 2;
+	}
+
+public:
+	class Iter {
+		ArgsBuffer*  buffer;
+		uint  index;
+
+	public:
+		Iter( ArgsBuffer&  pBuffer )
+			: buffer(&pBuffer)
+			, index(0)
+		{}
+
+		bool has() const {
+			return buffer->count > 0;
+		}
+
+		bool next() {
+			if ( index + 1 >= buffer->count )
+				return false;
+			++index;
+			return true;
+		}
+
+		void reset() {
+			index = 0;
+		}
+
+		Object*& operator* () {
+			return buffer->items[index];
+		}
+	};
+
+	ArgsBuffer()
+		: items(inlineItems)
+		, count(0)
+		, capacity(CU_ARGS_INLINE_SIZE)
+	{}
+
+	ArgsBuffer( const ArgsBuffer&  pOther )
+		: items(inlineItems)
+		, count(0)
+		, capacity(CU_ARGS_INLINE_SIZE)
+	{
+		uint i = 0;
+		for (; i < pOther.count; ++i)
+			push_back(pOther.items[i]);
+	}
+
+	~ArgsBuffer() {
+		if ( items != inlineItems )
+			delete[] items;
+	}
+
+	void push_back( Object*  pItem ) {
+		if ( count == capacity )
+			grow();
+		items[count] = pItem;
+		++count;
+	}
+
+	Object* get( uint  pIndex ) const {
+		return items[pIndex];
+	}
+
+	Object* getFirst() const {
+		return items[0];
+	}
+
+	uint size() const {
+		return count;
+	}
+
+	bool has() const {
+		return count > 0;
+	}
+
+	Iter start() {
+		return Iter(*this);
+	}
+
+	// Drops the items at and after the given index
+	void truncate( uint  pSize ) {
+		if ( pSize < count )
+			count = pSize;
+	}
+
+	void clear() {
+		count = 0;
+	}
+};
+
 struct FuncFoundTask : public Task {
 	//const VarAddress  varAddress; // MUST NOT BE A VarAddress&!!
 	VarAddress*  varAddress;
-	ArgsList  args;
+	ArgsBuffer  args;
 
 	//explicit FuncFoundTask( const VarAddress& pVarAddress );
 	explicit FuncFoundTask( VarAddress* pVarAddress );
@@ -3108,6 +4337,13 @@ struct FuncFoundTask : public Task {
 	void
 	addArg( Object* a );
 
+	// Releases the address and arguments so the task can be reused by setAddress()
+	void
+	release();
+
+	void
+	setAddress( VarAddress* pVarAddress );
+
 	const VarAddress&
 	getAddress() const {
 		return *varAddress;
@@ -3128,13 +4364,17 @@ struct FuncFoundParseTask : public ParseTask {
 	Opcode* code;
 	bool waitingOnAssignment;
 	UInteger openBodies;
+	bool isSysCall; // Calls a built-in function, so arguments are passed on the engine's argument stack
+	UInteger argCount;
 
-	FuncFoundParseTask( const String& pName )
+	FuncFoundParseTask( const Symbol& pName )
 		: ParseTask(ParseTask::FuncFound)
 		, state(Start)
 		, code(new Opcode(Opcode::FuncFound_access, pName, true))
 		, waitingOnAssignment(false)
 		, openBodies(1)
+		, isSysCall(false)
+		, argCount(0)
 	{}
 
 	~FuncFoundParseTask() {
@@ -3145,10 +4385,10 @@ struct FuncFoundParseTask : public ParseTask {
 class NullIfStructureConditionException {};
 
 struct IfStructureParseTask : public ParseTask {
-	OpStrandIter firstIter;
 	UInteger openBodies; // used for both parameter and execution body token counting
-	Opcode* conditionalGoto;
-	List<Opcode*> finalGotos;
+	uint conditionalGoto; // Index of the conditional goto in the strand
+	bool hasConditionalGoto;
+	List<uint> finalGotos;
 	bool atElse;
 
 	enum State {
@@ -3158,13 +4398,13 @@ struct IfStructureParseTask : public ParseTask {
 		PostBody
 	} state;
 
-	IfStructureParseTask( OpStrand* strand );
+	IfStructureParseTask();
 
-	// Queues a conditional goto meant to be set to the next terminal when added
-	void queueNewConditionalJump( Opcode* jump );
+	// Queues a conditional goto (by index) meant to be set to the next terminal when added
+	void queueNewConditionalJump( uint jump );
 
-	// Queues a new goto meant to be set to the last terminal when added
-	void queueNewFinalJumpCode( Opcode* jump );
+	// Queues a new goto (by index) meant to be set to the last terminal when added
+	void queueNewFinalJumpCode( uint jump );
 
 	void finalizeConditionalGoto( ParserContext& context );
 
@@ -3172,8 +4412,8 @@ struct IfStructureParseTask : public ParseTask {
 };
 
 struct LoopStructureParseTask : public ParseTask {
-	OpStrandIter firstIter;
-	List<Opcode*> finalGotos;
+	uint firstIndex; // Index of the terminal preceding the loop
+	List<uint> finalGotos;
 	UInteger openBodies;
 
 	enum State {
@@ -3184,9 +4424,9 @@ struct LoopStructureParseTask : public ParseTask {
 
 	LoopStructureParseTask( OpStrand* strand );
 
-	void setGotoOpcodeToLoopStart( Opcode* code );
+	void setGotoOpcodeToLoopStart( OpStrand* strand, uint code );
 
-	void queueFinalGoto( Opcode* code );
+	void queueFinalGoto( uint code );
 
 	void finalizeGotos( OpStrand* strand );
 };
@@ -3235,7 +4475,7 @@ class FFIServices {
 	String			who;
 
 public:
-	FFIServices( Engine& enginePtr, ArgsList& argsList, String  foreignFuncName );
+	FFIServices( Engine& enginePtr, ArgsBuffer& argsList, String  foreignFuncName );
 
 	~FFIServices();
 
@@ -3344,9 +4584,9 @@ isEmptyFunctionObject(
 			return false;
 	}
 	return (
-		function->body.raw()->isEmpty()
+		( isNull(function->body.raw()) || function->body.raw()->isEmpty() )
 		&& function->params.size() == 0
-		&& function->getPersistentScope().occupancy() == 0
+		&& ( ! function->hasPersistentScope() || function->getPersistentScope().occupancy() == 0 )
 	);
 }
 
@@ -3392,8 +4632,9 @@ inline bool
 isNumericObject(
 	const Object& pObject
 ) {
-	//return pObject.getType() == ObjectType::Numeric;
-	return pObject.supportsInterface( ObjectType::Numeric );
+	// Only NumericObject uses the Numeric type, but other classes may support the interface.
+	return pObject.getType() == ObjectType::Numeric
+		|| pObject.supportsInterface( ObjectType::Numeric );
 }
 
 //--------------------------------
@@ -3434,17 +4675,25 @@ struct CustomObjectFactory {
 class Engine {
 	friend FFIServices; // Not needed if you don't require the FFI to directly set the lastObject
 
+	SymbolTable::Owner symbolTableOwner; // First so that it is destroyed after everything using symbols
 	Logger* logger;
 	Stack stack;
-	List<TaskContainer> taskStack; // Needs a getLast() method
+	TaskStack taskStack;
+	TaskStack spareFuncFoundTasks; // Finished FuncFoundTasks, emptied and kept for reuse
+	ArgsBuffer sysCallArgs; // Referenced arguments of built-in function calls in progress
 	RefPtr<Object> lastObject;
-	List<Token> bufferedTokens;
+	NilObject* nilObject; // Shared, immutable results. Held for the life of the engine.
+	BoolObject* trueObject;
+	BoolObject* falseObject;
+	TokenQueue bufferedTokens;
 	ParserContext globalParserContext;
 	OpStrandStack opcodeStrandStack;
 	OpStrandStack* activeOpcodeStrandStack;
 	EngineEndProcCallback* endMainCallback;
-	RobinHoodHash<SystemFunction::Value> builtinFunctions;
-	RobinHoodHash<ForeignFuncContainer> foreignFunctions;
+	RobinHoodHash<ForeignFuncContainer, Symbol> foreignFunctions;
+	UInteger foreignFunctionsStamp; // Changes whenever foreignFunctions changes. Unique among engines.
+	uint memberCacheHits;
+	uint memberCacheMisses;
 	bool ignoreBadForeignFunctionCalls;
 	bool ownershipChangingEnabled;
 	bool stackTracePrintingEnabled;
@@ -3455,6 +4704,8 @@ class Engine {
 public:
 	Engine(); // remember to initialize the logger
 
+	~Engine();
+
 	// WARNING: Logger is never referenced or dropped, so don't delete the logger before the Engine!
 	void setLogger( Logger* pLogger );
 
@@ -3525,8 +4776,40 @@ public:
 
 	void clearGlobals();
 
+	/* Statistics of the inline caches used for resolving members in addresses (such as "b" in "a.b").
+	A hit means the member variable was used without looking it up in a scope. */
+	uint getMemberCacheHits() const {
+		return memberCacheHits;
+	}
+
+	uint getMemberCacheMisses() const {
+		return memberCacheMisses;
+	}
+
+	void resetMemberCacheStats() {
+		memberCacheHits = 0;
+		memberCacheMisses = 0;
+	}
+
 protected:
 	void clearStacks();
+
+	// Dereferences and removes the built-in call arguments beyond the given count
+	void releaseSysCallArgs( uint  pSize );
+
+	// Tests the arguments of a SysCall_condition without running the call.
+	// Returns false if the call must be run instead (such as to print warnings about its arguments).
+	bool testCondition( SystemFunction::Value  pFunction, uint  pArgStart, bool&  pResult );
+
+	// Set the last object to a shared instance.
+	// These are never modified. Variables receive copies (see setVariableByAddress()).
+	void setLastObjectNil() {
+		lastObject.set(nilObject);
+	}
+
+	void setLastObjectBool( bool  pValue ) {
+		lastObject.set( pValue ? trueObject : falseObject );
+	}
 	void signalEndofProcessing();
 	void printTaskTrace();
 	void printStackTrace();
@@ -3534,9 +4817,6 @@ protected:
 	Scope&
 	getGlobalScope();
 
-	Scope&
-	getCurrentTopScope();
-
 	ParserContext&
 	getGlobalParserContext();
 
@@ -3553,22 +4833,23 @@ protected:
 
 	/*
 	\param pName - The token's assume name.
+	\param pSymbol - Set to the interned name for keywords and names.
 	\return - Returns the token that this name resolves to or TT_unknown if it does not resolve. */
 	TokenType
-	resolveTokenType( const String& pName );
+	resolveTokenType( const StringSpan& pName, Symbol& pSymbol );
 
 	Result::Value
 	tokenize(
-		CharList& tokenValue,
-		List<Token>& tokens
+		const StringSpan& tokenValue,
+		TokenQueue& tokens
 	);
 
 	Result::Value
 	handleCommentsStringsAndSpecials(
 					const TokenType&	tokenType,
-					CharList&			tokenValue,
-					List<Token>&		tokens,
-					ByteStream&			stream
+					const char			c,
+					TokenQueue&			tokens,
+					ByteStreamReader&	reader
 	);
 
 	bool isWhitespace(			const char c ) const;
@@ -3577,19 +4858,19 @@ protected:
 	bool isValidToken(			const TokenType& token ) const;
 	bool isValidNameCharacter(	const char c ) const;
 	bool isValidName(			const String& pName ) const;
+	bool isValidName(			const StringSpan& pName ) const;
 	bool isCommentToken(		const char c ) const;
 	bool isStringToken(			const char c ) const;
 
 	Result::Value
-	scanComment( ByteStream& stream );
+	scanComment( ByteStreamReader& reader );
 
 	Result::Value
 	collectString(
-		ByteStream& stream,
-		CharList& collectedValue
+		ByteStreamReader& reader,
+		TokenLiteral*& literal
 	);
 
-	void setupSystemFunctions();
 
 	// ----- PARSING SYSTEM -----
 
@@ -3771,6 +5052,11 @@ protected:
 	inline void
 	popLastTask();
 
+	inline FuncFoundTask*
+	createFuncFoundTask(
+		VarAddress*	address
+	);
+
 	inline void
 	addOpStrandToStack(
 		OpStrand*	strand
@@ -3802,25 +5088,48 @@ public:
 	Object*
 	getLastObject() const;
 
+	// Optimizes the opcodes of a newly compiled body. (See COPPER_ENABLE_BODY_OPTIMIZER.)
+	void
+	optimize( OpStrand&  strand );
+
 protected:
+	// Replaces a built-in call on literal arguments with its result. Returns true if the call was replaced.
+	bool
+	foldBuiltinCall( OpStrand&  strand, uint  callIndex, uint&  resultIndex );
+
+	// Returns a new reference to the object that the literal-creating instruction would create
+	// or REAL_NULL if the instruction does not create a literal.
+	Object*
+	createLiteralObject( OpStrand&  strand, const Instruction&  code );
+
+	void
+	threadJumps( OpStrand&  strand );
+
+	bool
+	removeUnreachableCode( OpStrand&  strand );
+
+	void
+	removeRedundantTerminals( OpStrand&  strand );
+
 
 	ExecutionResult::Value
 	operate(
 		OpStrandStackIter&	opStrandStackIter,
-		OpStrandIter&		opIter
+		OpStrandContainer&	opStrand
 	);
 
 	void
 	addForeignFunctionArgsToStackFrame(
 		StackFrame&  stackFrame,
-		const List<String>&  functionParams,
+		const List<Symbol>&  functionParams,
 		List<Object*>&  arguments
 	);
 
 	FuncExecReturn::Value
 	setupFunctionExecution(
 		FuncFoundTask& task,
-		OpStrandStackIter&	opStrandStackIter
+		OpStrandStackIter&	opStrandStackIter,
+		bool	tailCall = false
 	);
 
 	FuncExecReturn::Value
@@ -3834,10 +5143,18 @@ protected:
 		FuncFoundTask& task
 	);
 
+	// Returns the foreign function whose name is the full address, or REAL_NULL.
+	// The result is cached in the address until the foreign function table changes.
+	ForeignFunc*
+	findForeignFunction(
+		const VarAddress& address
+	);
+
 	FuncExecReturn::Value
 	setupUserFunctionExecution(
 		FuncFoundTask& task,
-		OpStrandStackIter&	opStrandStackIter
+		OpStrandStackIter&	opStrandStackIter,
+		bool	tailCall = false
 	);
 
 	Variable*
@@ -3845,6 +5162,62 @@ protected:
 		const VarAddress& address
 	);
 
+	// Looks for the variable of the first name of the address in the global scope.
+	// The result is cached in the address until the global scope changes.
+	bool
+	findGlobalVariable(
+		const VarAddress&	address,
+		Variable*&			var
+	);
+
+#ifdef COPPER_ENABLE_QUICKENING
+	// Returns the variable of a quickened FuncFound_access or REAL_NULL if the address no longer
+	// refers to what the opcode was quickened for.
+	Variable*
+	findQuickenedVariable(
+		Opcode::Type		type,
+		const VarAddress&	address
+	);
+
+	// Rewrites the current FuncFound_access opcode for where its variable was found.
+	void
+	quickenAccess(
+		OpStrandContainer&	opStrand,
+		const VarAddress&	address
+	);
+
+	// Returns the variable whose function a FuncFound_callDirect opcode calls, or REAL_NULL if
+	// it is not a user function that exists.
+	Variable*
+	findDirectCallVariable(
+		const VarAddress&	address
+	);
+
+	// Rewrites the current FuncFound_call opcode to FuncFound_callDirect if it calls a user function
+	// without arguments.
+	void
+	quickenFoundCall(
+		OpStrandContainer&	opStrand,
+		const VarAddress&	address
+	);
+
+	// Rewrites the current FuncFound_finish opcode for the kind of function called.
+	// Returns true if it calls a user function.
+	bool
+	quickenCall(
+		OpStrandContainer&	opStrand,
+		const VarAddress&	address
+	);
+#endif
+
+	// Returns the variable of the member named at the address iterator, which belongs
+	// to the function of the given variable. The member is created if it does not exist.
+	Variable*
+	getMemberVariable(
+		VarAddress::Iterator&	ai,
+		Variable*				var
+	);
+
 	ExecutionResult::Value
 	run_Own(
 		const VarAddress& address
@@ -3945,6 +5318,14 @@ protected:
 		SystemFunction::Value  functionId
 	);
 
+	// Chain of arithmetic starting with an IntegerObject or DecimalNumObject.
+	// Values are computed unboxed, so only the final result is allocated.
+	FuncExecReturn::Value
+	process_sys_num_chain_unboxed(
+		FuncFoundTask&  task,
+		SystemFunction::Value  functionId
+	);
+
 	FuncExecReturn::Value
 	process_sys_solo_num(
 		FuncFoundTask&  task,
@@ -3,345 +3,334 @@
 #ifndef ROBIN_HOOD_HASH_H
 #define ROBIN_HOOD_HASH_H
 
+#include <new> // For placement new
+#include <cstring> // For memcpy and memset
 #include "Strings.h"
 
 namespace util {
 
 //! Robin Hood Hash Table
 /*
-	One limitation of this table is that the items stored here must have a default empty constructor.
+	Entries (name, cached hash, and item) are stored inline in a single contiguous array.
+	Names are Strings by default, but any key class with keyValue() and equals() may be used.
+	The probe length of each slot is kept in a separate array so that empty slots need no
+	constructed data. Deletion shifts following entries backwards, so no tombstones are needed.
+
+	Limitations:
+	- Items inserted without a value must have a default empty constructor.
+	- Entries are moved around the table with memcpy, so neither the items nor the names may
+	hold pointers to themselves. All current users (RefVariableStorage, ForeignFuncContainer,
+	and enum values) meet this requirement.
+	- Pointers returned by get(), getBucketData() and insert() are only valid until the next
+	insert() or erase().
 */
-template<class T>
+template<class T, class K = String>
 class RobinHoodHash {
 public:
 	struct BucketData {
-		const String name;
+		const K name;
 		T item;
-		uint delay; // Time to reach this data
+		const uint hash; // Cached name.keyValue()
 
-		BucketData(const String& pName)
+		BucketData(const K& pName, uint pHash)
 			: name(pName)
 			, item()
-			, delay(0)
+			, hash(pHash)
 		{}
 
-		BucketData(const String& pName, T& pItem)
+		BucketData(const K& pName, uint pHash, T& pItem)
 			: name(pName)
 			, item(pItem)
-			, delay(0)
+			, hash(pHash)
 		{}
 
 		BucketData(const BucketData& pOther)
 			: name(pOther.name)
 			, item(pOther.item)
-			, delay(pOther.delay)
+			, hash(pOther.hash)
 		{}
 	};
 
-	struct Bucket {
-		BucketData* data;
-		bool wasOccupied;
-
-		Bucket() : data(0), wasOccupied(false) {}
-
-		Bucket(const Bucket& b)
-			: data(new BucketData(b.data->name, b.data->item))
-			, wasOccupied(false)
-		{}
-
-		~Bucket() {
-			clear();
-		}
-
-		Bucket& operator= (const Bucket& b) {
-			if ( b.data ) {
-				data = new BucketData(b.data->name, b.data->item);
-			} else {
-				data = 0;
-			}
-			wasOccupied = false;
-			return *this;
-		}
-
-		void clear() {
-			if ( data ) {
-				delete data; // This line was causing a crash
-				data = 0;
-				wasOccupied = true;
-			}
-		}
-	};
-
 private:
 	uint size;
 	uint occupancy;
-	Bucket* buckets;
+	BucketData* buckets; // Raw storage. Only slots with a non-zero probe value are constructed.
+	uint* probes; // Probe length + 1 of the entry in each slot, or zero if the slot is empty
+
 protected:
 	void jump(uint& pIndex);
-	uint getInitKey(const String& pName);
+	uint getInitKey(uint pHash);
+	void allocateTable();
 	void resizeTable();
+	void relocate(const void* pEntry, uint pIndex, uint pProbe);
+	uint openSlot(uint pHash);
+
 public:
 	RobinHoodHash(uint pInitSize);
-	RobinHoodHash(const RobinHoodHash<T>& pOther);
+	RobinHoodHash(const RobinHoodHash<T,K>& pOther);
 	~RobinHoodHash();
-	void appendCopyOf(RobinHoodHash<T>& pOther);
-	Bucket* get(uint pIndex);
-	BucketData* getBucketData(const String& pName);
-	T* insert(const String& pName, T pItem);
-	T* insert(const String& pName);
+	void appendCopyOf(RobinHoodHash<T,K>& pOther);
+	BucketData* get(uint pIndex); // Returns 0 for empty slots
+	uint getDelay(uint pIndex) const; // Time to reach the data in the given slot
+	BucketData* getBucketData(const K& pName);
+	// For keys of other types (such as a StringSpan for a String) that K can be compared with
+	// and that have the same keyValue() as the equivalent K.
+	template<class Key>
+	BucketData* findBucketData(const Key& pKey);
+	T* insert(const K& pName, T pItem);
+	T* insert(const K& pName);
 	uint getSize() const;
 	uint getOccupancy() const;
-	void erase(const String& pName);
-
-	// For cases where you really need the table
-	Bucket* getTablePointer();
+	void erase(const K& pName);
 };
 
-template<class T>
-RobinHoodHash<T>::RobinHoodHash(uint pInitSize)
+template<class T, class K>
+RobinHoodHash<T,K>::RobinHoodHash(uint pInitSize)
 	: size(pInitSize)
 	, occupancy(0)
+	, buckets(0)
+	, probes(0)
 {
-	// NOTE: These loops don't seem to impact speed much, and they provide safety.
 	// Create a power of 2 size
 	uint realSize = 1;
 	for(; realSize < size; realSize <<= 1);
 	size = realSize;
 
-	//buckets = new Bucket[size]();
-	buckets = new Bucket[size];
-	uint i = 0;
-	for (; i < size; ++i) {
-		buckets[i] = Bucket();
-	}
+	allocateTable();
 }
 
-template<class T>
-RobinHoodHash<T>::RobinHoodHash(const RobinHoodHash<T>& pOther) // Which is best: const or non-const?
+template<class T, class K>
+RobinHoodHash<T,K>::RobinHoodHash(const RobinHoodHash<T,K>& pOther) // Which is best: const or non-const?
 	: size(pOther.size)
 	, occupancy(pOther.occupancy)
+	, buckets(0)
+	, probes(0)
 {
-	//buckets = new Bucket[size]();
-	buckets = new Bucket[size];
-	BucketData* bucketData;
+	allocateTable();
 	uint i=0;
 	for(; i < size; ++i) {
-		buckets[i] = Bucket();
-		bucketData = pOther.buckets[i].data;
-		if ( bucketData ) {
-			buckets[i].data = new BucketData(*bucketData);
-		} else {
-			buckets[i].data = 0;
+		probes[i] = pOther.probes[i];
+		if ( probes[i] ) {
+			// Copying from const data creates a true copy of the item
+			new (&(buckets[i])) BucketData( (const BucketData&)(pOther.buckets[i]) );
 		}
 	}
 }
 
-template<class T>
-void RobinHoodHash<T>::appendCopyOf(RobinHoodHash<T>& pOther) {
+template<class T, class K>
+void RobinHoodHash<T,K>::appendCopyOf(RobinHoodHash<T,K>& pOther) {
 	uint i=0;
-	BucketData* bucketData;
 	for(; i < pOther.size; ++i) {
-		bucketData = pOther.buckets[i].data;
-		if ( bucketData ) {
-			insert(bucketData->name, bucketData->item);
+		if ( pOther.probes[i] ) {
+			insert(pOther.buckets[i].name, pOther.buckets[i].item);
 		}
 	}
 }
 
-template<class T>
-RobinHoodHash<T>::~RobinHoodHash() {
-	delete[] buckets;
+template<class T, class K>
+RobinHoodHash<T,K>::~RobinHoodHash() {
+	uint i=0;
+	for(; i < size; ++i) {
+		if ( probes[i] )
+			buckets[i].~BucketData();
+	}
+	::operator delete( (void*)buckets );
+	delete[] probes;
 }
 
-template<class T>
-typename RobinHoodHash<T>::Bucket* RobinHoodHash<T>::get(uint pIndex) {
+template<class T, class K>
+typename RobinHoodHash<T,K>::BucketData* RobinHoodHash<T,K>::get(uint pIndex) {
+	if ( probes[pIndex] == 0 )
+		return 0;
 	return &(buckets[pIndex]);
 }
 
-template<class T>
-void RobinHoodHash<T>::jump(uint& pIndex) {
+template<class T, class K>
+uint RobinHoodHash<T,K>::getDelay(uint pIndex) const {
+	if ( probes[pIndex] == 0 )
+		return 0;
+	return probes[pIndex] - 1;
+}
+
+template<class T, class K>
+void RobinHoodHash<T,K>::jump(uint& pIndex) {
 	//pIndex = (pIndex + 1) % size; // Safe jump - REALLY SLOW
 	// The following requires a size of a power of 2
 	// See https://craftinginterpreters.com/optimization.html
 	pIndex = (pIndex + 1) & (size - 1);
 }
 
-template<class T>
-uint RobinHoodHash<T>::getInitKey(const String& pName) {
-	//return pName.keyValue() % size; // REALLY SLOW
+template<class T, class K>
+uint RobinHoodHash<T,K>::getInitKey(uint pHash) {
+	//return pHash % size; // REALLY SLOW
 	// The following requires a size of a power of 2
-	return pName.keyValue() & (size - 1);
+	return pHash & (size - 1);
+}
+
+template<class T, class K>
+void RobinHoodHash<T,K>::allocateTable() {
+	// Raw memory: Entries are constructed in place when inserted.
+	buckets = (BucketData*) ::operator new( sizeof(BucketData) * size );
+	probes = new uint[size];
+	std::memset( (void*)probes, 0, sizeof(uint) * size );
 }
 
-template<class T>
-typename RobinHoodHash<T>::BucketData* RobinHoodHash<T>::getBucketData(const String& pName) {
+template<class T, class K>
+typename RobinHoodHash<T,K>::BucketData* RobinHoodHash<T,K>::getBucketData(const K& pName) {
+	return findBucketData(pName);
+}
+
+template<class T, class K>
+template<class Key>
+typename RobinHoodHash<T,K>::BucketData* RobinHoodHash<T,K>::findBucketData(const Key& pName) {
 	if ( occupancy == 0 ) // short-circuit
 		return 0;
-	uint idx = getInitKey(pName);
-	uint jumpCount = 0;
-	Bucket* initBucket = get(idx);
-	Bucket* bucket = initBucket;
-	while ( bucket->data != 0 || bucket->wasOccupied ) {
-		if ( bucket->data->name.equals(pName) ) {
-			return bucket->data;
-		}
-		// This if-statement's safety unconfirmed
-		if ( bucket->data->delay < jumpCount ) {
-			// If the bucket existed, it would have been inserted earlier.
-			return 0;
+	const uint hash = pName.keyValue();
+	uint idx = getInitKey(hash);
+	uint probe = 1; // Probe values are offset by 1
+	// Stop at an empty slot or at an entry closer to its home than this name would be.
+	// If the name existed, it would have been inserted earlier.
+	while ( probes[idx] >= probe ) {
+		// Hashes are cached, so comparing them first avoids most string comparisons.
+		if ( buckets[idx].hash == hash && buckets[idx].name.equals(pName) ) {
+			return &(buckets[idx]);
 		}
 		jump(idx);
-		++jumpCount;
-		bucket = get(idx);
-		if ( bucket == initBucket ) // This is problematic if the jump doesn't cycle thru all open spots
-			return 0;
+		++probe;
 	}
 	return 0;
 }
 
-template<class T>
-T* RobinHoodHash<T>::insert(const String& pName, T pItem) {
-	uint idx = getInitKey(pName);
-	Bucket* initBucket = get(idx);
-	Bucket* bucket = initBucket;
-	BucketData* floatData = new BucketData(pName, pItem);
-	T* itemPtr = &(floatData->item);
-	BucketData* tempData = 0;
-	while( true ) {
-		//if ( bucket == 0 ) throw 1;
-		if ( bucket->data == 0 ) {
-			bucket->data = floatData;
-			++occupancy;
-			return itemPtr;
-		}
-		// else data != 0
-		if ( bucket->data->name.equals(floatData->name) ) {
-			// Replacing data should only be done directly, via getBucketdata()
-			// Smelled like a memory leak, so I started deleting floatData.
-			delete floatData;
-			return itemPtr;
-		}
-		// Compare delays to reach
-		// May be problematic if index jump exceeds 1.
-		if ( bucket->data->delay < floatData->delay ) {
-			tempData = bucket->data;
-			bucket->data = floatData;
-			floatData = tempData;
-		}
+template<class T, class K>
+T* RobinHoodHash<T,K>::insert(const K& pName, T pItem) {
+	BucketData* bucketData = getBucketData(pName);
+	if ( bucketData ) {
+		// Replacing data should only be done directly, via getBucketData()
+		return &(bucketData->item);
+	}
+	const uint hash = pName.keyValue();
+	const uint idx = openSlot(hash); // May resize, so get the slot before using the table
+	bucketData = new ( &(buckets[idx]) ) BucketData(pName, hash, pItem);
+	return &(bucketData->item);
+}
+
+template<class T, class K>
+T* RobinHoodHash<T,K>::insert(const K& pName) {
+	BucketData* bucketData = getBucketData(pName);
+	if ( bucketData ) {
+		return &(bucketData->item);
+	}
+	const uint hash = pName.keyValue();
+	const uint idx = openSlot(hash); // May resize, so get the slot before using the table
+	bucketData = new ( &(buckets[idx]) ) BucketData(pName, hash);
+	return &(bucketData->item);
+}
+
+// Finds the slot for a new entry whose name is known not to be in the table.
+// The returned slot is counted as occupied but must still be constructed.
+template<class T, class K>
+uint RobinHoodHash<T,K>::openSlot(uint pHash) {
+	// Keep the load below 3/4 so that probe chains stay short.
+	if ( (occupancy + 1) * 4 > size * 3 ) {
+		resizeTable();
+	}
+	uint idx = getInitKey(pHash);
+	uint probe = 1;
+	while ( probes[idx] >= probe ) {
 		jump(idx);
-		bucket = get(idx);
-		floatData->delay++;
-		// If all spots are checked, try to resize the table.
-		if ( bucket == initBucket ) {
-			resizeTable();
-			// Restart search for a location because the table has changed
-			idx = getInitKey(floatData->name);
-			initBucket = get(idx);
-			bucket = initBucket;
-		}
+		++probe;
+	}
+	// This slot is either empty or holds an entry closer to its home than the new one would be.
+	// In the latter case, the existing entry is moved down the chain.
+	if ( probes[idx] ) {
+		char displaced[sizeof(BucketData)];
+		std::memcpy( (void*)displaced, (void*)&(buckets[idx]), sizeof(BucketData) );
+		uint nextIdx = idx;
+		jump(nextIdx);
+		relocate( displaced, nextIdx, probes[idx] + 1 );
 	}
+	probes[idx] = probe;
+	++occupancy;
+	return idx;
 }
 
-template<class T>
-T* RobinHoodHash<T>::insert(const String& pName) {
-	uint idx = getInitKey(pName);
-	Bucket* initBucket = get(idx);
-	Bucket* bucket = initBucket;
-	BucketData* floatData = new BucketData(pName);
-	T* itemPtr = &(floatData->item);
-	BucketData* tempData = 0;
-	while( true ) {
-		//if ( bucket == 0 ) throw 1;
-		if ( bucket->data == 0 ) {
-			bucket->data = floatData;
-			++occupancy;
-			return itemPtr;
-		}
-		// else data != 0
-		if ( bucket->data->name.equals(floatData->name) ) {
-			// Replacing data should only be done directly, via getBucketdata()
-			// Smelled like a memory leak, so I started deleting floatData.
-			delete floatData;
-			return itemPtr;
-		}
-		// Compare delays to reach
-		// May be problematic if index jump exceeds 1.
-		if ( bucket->data->delay < floatData->delay ) {
-			tempData = bucket->data;
-			bucket->data = floatData;
-			floatData = tempData;
+// Moves the bytes of an already-counted entry into the table, starting at the given slot,
+// where the entry would have the given probe value (probe length + 1).
+template<class T, class K>
+void RobinHoodHash<T,K>::relocate(const void* pEntry, uint pIndex, uint pProbe) {
+	char floatEntry[sizeof(BucketData)];
+	char swapEntry[sizeof(BucketData)];
+	std::memcpy( (void*)floatEntry, pEntry, sizeof(BucketData) );
+	uint idx = pIndex;
+	uint probe = pProbe;
+	uint temp;
+	while ( probes[idx] != 0 ) {
+		if ( probes[idx] < probe ) {
+			// Take from the rich and give to the poor
+			std::memcpy( (void*)swapEntry, (void*)&(buckets[idx]), sizeof(BucketData) );
+			std::memcpy( (void*)&(buckets[idx]), (void*)floatEntry, sizeof(BucketData) );
+			std::memcpy( (void*)floatEntry, (void*)swapEntry, sizeof(BucketData) );
+			temp = probes[idx];
+			probes[idx] = probe;
+			probe = temp;
 		}
 		jump(idx);
-		bucket = get(idx);
-		floatData->delay++;
-		// If all spots are checked, try to resize the table.
-		if ( bucket == initBucket ) {
-			resizeTable();
-			// Restart search for a location because the table has changed
-			idx = getInitKey(floatData->name);
-			initBucket = get(idx);
-			bucket = initBucket;
-		}
+		++probe;
 	}
+	std::memcpy( (void*)&(buckets[idx]), (void*)floatEntry, sizeof(BucketData) );
+	probes[idx] = probe;
 }
 
-template<class T>
-uint RobinHoodHash<T>::getSize() const {
+template<class T, class K>
+uint RobinHoodHash<T,K>::getSize() const {
 	return size;
 }
 
-template<class T>
-uint RobinHoodHash<T>::getOccupancy() const {
+template<class T, class K>
+uint RobinHoodHash<T,K>::getOccupancy() const {
 	return occupancy;
 }
 
-template<class T>
-void RobinHoodHash<T>::erase(const String& pName) {
-	if ( occupancy == 0 ) // short-circuit
+template<class T, class K>
+void RobinHoodHash<T,K>::erase(const K& pName) {
+	BucketData* bucketData = getBucketData(pName);
+	if ( ! bucketData )
 		return;
-	uint idx = getInitKey(pName);
-	Bucket* initBucket = get(idx);
-	Bucket* bucket = initBucket;
-	while ( bucket->data != 0 || bucket->wasOccupied ) {
-		if ( bucket->data->name.equals(pName) ) {
-			bucket->clear();
-			--occupancy;
-			return;
-		}
-		jump(idx);
-		bucket = get(idx);
-		if ( bucket == initBucket ) // This is problematic if the jump doesn't cycle thru all open spots
-			return;
+	uint idx = (uint)(bucketData - buckets);
+	bucketData->~BucketData();
+	--occupancy;
+	// Backward-shift deletion: Pull each following entry one slot closer to its home
+	// until reaching an empty slot or an entry that is already at its home.
+	uint nextIdx = idx;
+	jump(nextIdx);
+	while ( probes[nextIdx] > 1 ) {
+		std::memcpy( (void*)&(buckets[idx]), (void*)&(buckets[nextIdx]), sizeof(BucketData) );
+		probes[idx] = probes[nextIdx] - 1;
+		idx = nextIdx;
+		jump(nextIdx);
 	}
+	probes[idx] = 0;
 }
 
-template<class T>
-void RobinHoodHash<T>::resizeTable() {
+template<class T, class K>
+void RobinHoodHash<T,K>::resizeTable() {
 	// Attempt to make the table larger (double the size)
-	// Unfortunately, buckets can't be simply copied to a new array because their position
+	// Entries can't be simply copied to a new array because their position
 	// depends on a jump that cycles based on the current array size.
-	Bucket* oldBuckets = buckets;
+	// Entries are moved rather than copied, so items are never copied or destroyed here.
+	BucketData* oldBuckets = buckets;
+	uint* oldProbes = probes;
 	uint oldSize = size;
 	size *= 2;
-	buckets = new Bucket[size];
+	allocateTable();
 	uint i=0;
-	for (; i < size; ++i) {
-		buckets[i] = Bucket();
-	}
-	i = 0;
-	occupancy = 0; // Reset because everything must be re-added
 	for (; i < oldSize; ++i) {
-		Bucket oldBucket = oldBuckets[i];
-		if ( oldBucket.data != 0 ) {
-			insert( oldBucket.data->name, oldBucket.data->item );
+		if ( oldProbes[i] ) {
+			relocate( &(oldBuckets[i]), getInitKey(oldBuckets[i].hash), 1 );
 		}
 	}
-	delete[] oldBuckets;
-}
-
-template<class T>
-typename RobinHoodHash<T>::Bucket*  RobinHoodHash<T>::getTablePointer() {
-	return buckets;
+	::operator delete( (void*)oldBuckets );
+	delete[] oldProbes;
 }
 
 }
@@ -0,0 +1,109 @@
+// Copyright 2016 Nicolaus Anderson
+
+#include "SlabAllocator.h"
+#include <new> // For operator new
+
+namespace util {
+
+SlabAllocator::SizeClass SlabAllocator::sizeClasses[SlabAllocator::SizeClassCount];
+SlabAllocator::Stats SlabAllocator::oversizedStats;
+
+void*
+SlabAllocator::allocate( size_t pSize ) {
+	if ( pSize == 0 )
+		pSize = 1;
+	if ( pSize > MaxBlockSize ) {
+		++oversizedStats.allocations;
+		return ::operator new(pSize);
+	}
+	SizeClass& sizeClass = sizeClasses[getClassIndex(pSize)];
+	++sizeClass.stats.allocations;
+	if ( sizeClass.freeList ) {
+		FreeBlock* block = sizeClass.freeList;
+		sizeClass.freeList = block->next;
+		return (void*)block;
+	}
+	const uint blockSize = (getClassIndex(pSize) + 1) * Granularity;
+	if ( sizeClass.bump == sizeClass.bumpEnd ) {
+		addSlab(sizeClass, blockSize);
+	}
+	void* block = (void*)sizeClass.bump;
+	sizeClass.bump += blockSize;
+	return block;
+}
+
+void
+SlabAllocator::release( void* pBlock, size_t pSize ) {
+	if ( ! pBlock )
+		return;
+	if ( pSize == 0 )
+		pSize = 1;
+	if ( pSize > MaxBlockSize ) {
+		++oversizedStats.releases;
+		::operator delete(pBlock);
+		return;
+	}
+	SizeClass& sizeClass = sizeClasses[getClassIndex(pSize)];
+	++sizeClass.stats.releases;
+	FreeBlock* block = (FreeBlock*)pBlock;
+	block->next = sizeClass.freeList;
+	sizeClass.freeList = block;
+}
+
+const SlabAllocator::Stats&
+SlabAllocator::getStats( size_t pSize ) {
+	if ( pSize == 0 )
+		pSize = 1;
+	if ( pSize > MaxBlockSize )
+		return oversizedStats;
+	return sizeClasses[getClassIndex(pSize)].stats;
+}
+
+const SlabAllocator::Stats&
+SlabAllocator::getOversizedStats() {
+	return oversizedStats;
+}
+
+void
+SlabAllocator::freeUnusedSlabs() {
+	SlabHeader* slab;
+	uint i = 0;
+	for (; i < SizeClassCount; ++i) {
+		SizeClass& sizeClass = sizeClasses[i];
+		if ( sizeClass.stats.getLiveCount() != 0 )
+			continue;
+		// Every block is either on the free list or not yet bumped to, so both can be dropped.
+		while ( sizeClass.slabs ) {
+			slab = sizeClass.slabs;
+			sizeClass.slabs = slab->next;
+			::operator delete( (void*)slab );
+		}
+		sizeClass.freeList = 0;
+		sizeClass.bump = 0;
+		sizeClass.bumpEnd = 0;
+	}
+}
+
+void
+SlabAllocator::addSlab( SizeClass& pClass, uint pBlockSize ) {
+	// The slab holds a whole number of blocks so that the bump pointer lands exactly on the end.
+	// Blocks are aligned because the slab is aligned for any type, and both the header and the
+	// block size are multiples of Granularity.
+	const uint blockCount = (SlabSize - Granularity) / pBlockSize;
+	char* slab = (char*) ::operator new( Granularity + blockCount * pBlockSize );
+	((SlabHeader*)slab)->next = pClass.slabs;
+	pClass.slabs = (SlabHeader*)slab;
+	pClass.bump = slab + Granularity;
+	pClass.bumpEnd = pClass.bump + blockCount * pBlockSize;
+	++pClass.stats.slabs;
+}
+
+// Returns the unused slabs when the program ends. Objects destroyed earlier (such as engines
+// in main()) have released their blocks by then.
+static struct SlabTeardown {
+	~SlabTeardown() {
+		SlabAllocator::freeUnusedSlabs();
+	}
+} slabTeardown;
+
+}
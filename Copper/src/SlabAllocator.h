@@ -0,0 +1,99 @@
+// Copyright 2016 Nicolaus Anderson
+
+#ifndef UTIL_SLAB_ALLOCATOR_H
+#define UTIL_SLAB_ALLOCATOR_H
+
+#include <cstddef> // For size_t
+
+// Uncomment to allocate all reference-counted classes of the engine (objects, variables, functions,
+// tasks, etc.), address nodes, and list nodes from the slab allocator rather than the heap.
+// Defined here so that every file including utilList.h agrees on it.
+// The allocator is static state shared by the whole process without locking, so it must not be
+// used by engines on separate threads; define UNDEF_COPPER_USE_SLAB_ALLOCATOR for that.
+#define COPPER_USE_SLAB_ALLOCATOR
+
+#ifdef UNDEF_COPPER_USE_SLAB_ALLOCATOR
+#undef COPPER_USE_SLAB_ALLOCATOR
+#endif
+
+namespace util {
+
+typedef unsigned long	uint;
+
+//! Slab Allocator
+/*
+	Size-classed pool for the small objects the engine creates and destroys constantly
+	(data objects, variables, functions, tasks, list nodes, etc.).
+	Requests are rounded up to a multiple of Granularity. Each size class takes blocks from a
+	free list or, if that is empty, by bumping a pointer through its current slab.
+	Released blocks go back on the free list of their size class, so memory is reused rather than
+	returned to the system. The slabs of each size class are listed so that freeUnusedSlabs() can
+	return them once none of their blocks are in use. It is called when the program ends, and
+	size classes with blocks still in use then (such as by objects in static storage) keep theirs.
+	Requests larger than MaxBlockSize go directly to the global operator new.
+
+	Limitations:
+	- Not thread-safe. Define UNDEF_COPPER_USE_SLAB_ALLOCATOR when engines run on separate threads.
+	- release() must be given the same size that was given to allocate().
+*/
+class SlabAllocator {
+public:
+	static const uint Granularity = 16;
+	static const uint MaxBlockSize = 256;
+	static const uint SizeClassCount = MaxBlockSize / Granularity;
+	static const uint SlabSize = 16384;
+
+	struct Stats {
+		uint allocations;
+		uint releases;
+		uint slabs;
+
+		uint getLiveCount() const {
+			return allocations - releases;
+		}
+	};
+
+	static void* allocate( size_t pSize );
+	static void release( void* pBlock, size_t pSize );
+
+	// Statistics for the size class of blocks of the given size
+	static const Stats& getStats( size_t pSize );
+
+	// Statistics for requests too large for any size class
+	static const Stats& getOversizedStats();
+
+	// Frees the slabs of every size class with no blocks in use
+	static void freeUnusedSlabs();
+
+private:
+	struct FreeBlock {
+		FreeBlock* next;
+	};
+
+	// Start of each slab. Takes Granularity bytes so that the blocks after it stay aligned.
+	struct SlabHeader {
+		SlabHeader* next;
+	};
+
+	struct SizeClass {
+		FreeBlock* freeList;
+		char* bump; // Next unused block of the current slab
+		char* bumpEnd;
+		SlabHeader* slabs;
+		Stats stats;
+	};
+
+	// Zero-initialized before any dynamic initialization, so allocating during static init is safe.
+	static SizeClass sizeClasses[SizeClassCount];
+	static Stats oversizedStats;
+
+	static uint getClassIndex( size_t pSize ) {
+		return (uint)( (pSize + Granularity - 1) / Granularity ) - 1;
+	}
+
+	static void addSlab( SizeClass& pClass, uint pBlockSize );
+};
+
+}
+
+#endif
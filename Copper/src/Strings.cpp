@@ -35,6 +35,62 @@ bool isAlphaNumeric(const char& c) {
 	return ('a' <= c ) && ( c <= 'z') && ( 'A' <= c ) && ( c <= 'Z' ) && ( '0' <= c ) && ( c <= '9' );
 }
 
+// 32-bit FNV-1a. Unlike a plain sum of bytes, this does not give anagrams
+// (e.g. "ab" and "ba") the same key, which kept hash table probe chains long.
+static uint hashBytes( const char* pBytes, uint pLength )
+{
+	unsigned int h = 2166136261u;
+	uint i = 0;
+	for ( ; i < pLength; ++i, ++pBytes ) {
+		h ^= (unsigned char)(*pBytes);
+		h *= 16777619u;
+	}
+	return h;
+}
+
+//---------------------------------------------
+bool StringSpan::equals( const char* pString ) const
+{
+	uint i = 0;
+	for ( ; i < length; ++i ) {
+		if ( pString[i] != start[i] ) // Includes the end of pString
+			return false;
+	}
+	return pString[length] == '\0';
+}
+
+unsigned char StringSpan::numberType() const {
+	uint i = 0;
+	const char* s = start;
+	unsigned char type = 1; // Integer type
+	bool binary_ok = true;
+	for ( ; i < length; ++i, ++s ) {
+		if ( (*s >= '0' && *s <= '9') ) {
+			if ( *s != '0' && *s != '1' )
+				binary_ok = false;
+			continue;
+		} else if ( *s == '.' ) {
+			binary_ok = false;
+			if ( type == 2 ) // Second decimal found! Bad number format!
+				return 0;
+			type = 2; // Decimal type
+			continue;
+		} else {
+			if ( i == length - 1 && *s == 'b' && binary_ok && (length-1)%8==0 ) {
+				type = 3; // Binary type
+				break;
+			}
+			return 0; // No numeric type
+		}
+	}
+	return type;
+}
+
+uint StringSpan::keyValue() const
+{
+	return hashBytes(start, length);
+}
+
 //---------------------------------------------
 CharList::CharList()
 {}
@@ -224,6 +280,16 @@ CharList& CharList::append( const String& pString )
 	return *this;
 }
 
+CharList& CharList::append( const StringSpan& pSpan )
+{
+	uint i = 0;
+	for ( ; i < pSpan.length; ++i )
+	{
+		push_back( pSpan.start[i] );
+	}
+	return *this;
+}
+
 bool CharList::equals( const char* pString )
 {
 	uint si = 0;
@@ -305,14 +371,17 @@ CharList::appendULong( const unsigned long pValue )
 String::String()
 	: str(0)
 	, len(0)
+	, hash(0)
 {
 	str = new char[len+1]; // fixed bad assignement thanks to valgrind
 	str[0] = '\0'; // only for returning as c-strings
+	updateHash();
 }
 
 String::String( const char* pString )
 	: str(0)
 	, len(0)
+	, hash(0)
 {
 	while ( pString[len] != '\0' )
 		len++;
@@ -321,11 +390,13 @@ String::String( const char* pString )
 	for ( ; i < len; ++i )
 		str[i] = pString[i];
 	str[len] = '\0'; // only for returning as c-strings
+	updateHash();
 }
 
 String::String( const String& pString )
 	: str( 0 )
 	, len( 0 )
+	, hash( pString.hash )
 {
 	str = new char[pString.len+1];
 	while ( len < pString.len )
@@ -339,10 +410,12 @@ String::String( const String& pString )
 String::String( const CharList& pList )
 	: str(0)
 	, len(0)
+	, hash(0)
 {
 	if ( ! pList.has() ) {
 		str = new char[1];
 		str[0] = '\0';
+		updateHash();
 		return;
 	}
 	str = new char[pList.size() + 1];
@@ -352,16 +425,32 @@ String::String( const CharList& pList )
 		len++;
 	} while ( i.next() );
 	str[len] = '\0'; // only for returning as c-strings
+	updateHash();
 }
 
 String::String( const char pChar )
 	: str(0)
 	, len(0)
+	, hash(0)
 {
 	str = new char[2];
 	len = 1;
 	str[0] = pChar;
 	str[1] = '\0'; // only for returning as c-strings
+	updateHash();
+}
+
+String::String( const StringSpan& pSpan )
+	: str(0)
+	, len(pSpan.length)
+	, hash(0)
+{
+	str = new char[len+1];
+	uint i = 0;
+	for ( ; i < len; ++i )
+		str[i] = pSpan.start[i];
+	str[len] = '\0'; // only for returning as c-strings
+	updateHash();
 }
 
 String::~String()
@@ -380,7 +469,10 @@ String::steal( String& pSource ) {
 	str = pSource.str;
 	pSource.str = new char[1];
 	len = pSource.len;
+	hash = pSource.hash;
+	pSource.str[0] = '\0';
 	pSource.len = 0;
+	pSource.updateHash();
 }
 
 String& String::operator= ( const String& pString )
@@ -389,6 +481,7 @@ String& String::operator= ( const String& pString )
 		return *this;
 
 	len = 0;
+	hash = pString.hash;
 	delete[] str;
 	str = new char[pString.len+1];
 	char* s = str;
@@ -424,6 +517,7 @@ String& String::operator= ( const char* pString )
 		++s2;
 	}
 	*s = '\0'; //str[len] = '\0'; // only for returning as c-strings
+	updateHash();
 	return *this;
 }
 
@@ -434,6 +528,7 @@ String& String::operator= ( const CharList& pList )
 	if ( ! pList.has() ) {
 		str = new char[1];
 		str[0] = '\0';
+		updateHash();
 		return *this;
 	}
 	//str = new char[pList.size() + 1];
@@ -447,6 +542,7 @@ String& String::operator= ( const CharList& pList )
 		++s;
 	} while ( i.next() );
 	*s = '\0'; //str[len] = '\0'; // only for returning as c-strings
+	updateHash();
 	return *this;
 }
 
@@ -465,6 +561,7 @@ String& String::operator+= ( const String& pString )
 	}
 	str[len] = '\0';
 	delete[] temp;
+	updateHash();
 	return *this;
 }
 
@@ -477,8 +574,10 @@ char String::operator[] ( uint pIndex ) const
 
 void String::set( uint pIndex, char pChar )
 {
-	if ( pIndex < len )
+	if ( pIndex < len ) {
 		str[pIndex] = pChar;
+		updateHash();
+	}
 }
 
 const char* String::c_str() const
@@ -496,7 +595,7 @@ bool String::equals( const String& pOther ) const
 	if ( str == pOther.str ) // Pointer comparison
 		return true;
 	// We want equality if the two strings are empty
-	if ( len != pOther.len )
+	if ( len != pOther.len || hash != pOther.hash )
 		return false;
 	if ( len == 0 ) return true; // Both are zero and thus equal
 
@@ -541,6 +640,18 @@ bool String::equals( const char* pString ) const
 	return util::equals(str, pString);
 }
 
+bool String::equals( const StringSpan& pSpan ) const
+{
+	if ( len != pSpan.length )
+		return false;
+	uint i = 0;
+	for ( ; i < len; ++i ) {
+		if ( str[i] != pSpan.start[i] )
+			return false;
+	}
+	return true;
+}
+
 bool String::equalsIgnoreCase( const String& pOther ) const
 {
 	// We want equality if the two strings are empty
@@ -702,6 +813,7 @@ void String::fromInt( int  value )
 		str[0] = '0';
 		str[1] = '\0';
 		len = 1;
+		updateHash();
 		return;
 	}
 
@@ -726,6 +838,7 @@ void String::fromDouble( double  value, uint prec )
 		str[0] = '0';
 		str[1] = '\0';
 		len = 1;
+		updateHash();
 		return;
 	}
 
@@ -807,40 +920,15 @@ bool String::contains( char c ) const {
 }
 
 unsigned char String::numberType() const {
-	uint i = 0;
-	char* s = str;
-	unsigned char type = 1; // Integer type
-	bool binary_ok = true;
-	for ( ; i < len; ++i, ++s ) {
-		if ( (*s >= '0' && *s <= '9') ) {
-			if ( *s != '0' && *s != '1' )
-				binary_ok = false;
-			continue;
-		} else if ( *s == '.' ) {
-			binary_ok = false;
-			if ( type == 2 ) // Second decimal found! Bad number format!
-				return 0;
-			type = 2; // Decimal type
-			continue;
-		} else {
-			if ( i == len - 1 && *s == 'b' && binary_ok && (len-1)%8==0 ) {
-				type = 3; // Binary type
-				break;
-			}
-			return 0; // No numeric type
-		}
-	}
-	return type;
+	return StringSpan(str, len).numberType();
 }
 
 uint String::keyValue() const {
-	uint i = 0;
-	uint key = 0;
-	char* s = str;
-	for ( ; i < len; ++i, ++s ) {
-		key += (uint)(*s);
-	}
-	return key;
+	return hash;
+}
+
+void String::updateHash() {
+	hash = hashBytes(str, len);
 }
 
 }
@@ -14,6 +14,26 @@ bool isAlphaNumeric(const char& c);
 
 class String; // predeclaration
 
+//! String Span
+// Characters in another buffer (such as that of the lexer) that can be hashed and compared
+// with Strings without being copied.
+struct StringSpan
+{
+	const char* start;
+	uint length;
+
+	StringSpan( const char* pStart, uint pLength )
+		: start(pStart)
+		, length(pLength)
+	{}
+
+	bool equals( const char* pString ) const; // string must be null-terminated
+	unsigned char numberType() const; // Same as String::numberType()
+
+	// Returns the same key-value as a String of these characters
+	uint keyValue() const;
+};
+
 // Technically, a string builder, and it should probably be renamed as such
 class CharList : public List<char>
 {
@@ -30,6 +50,7 @@ public:
 	CharList& operator= ( const CharList& pOther );
 	CharList& append( const CharList& pOther );
 	CharList& append( const String& pString );
+	CharList& append( const StringSpan& pSpan );
 	bool equals( const char* pString ); // string must be null-terminated
 	bool equals( const CharList& pOther );
 	bool equalsIgnoreCase( const CharList& pOther );
@@ -42,12 +63,16 @@ class String
 {
 	char* str;
 	uint len;
+	uint hash; // Cached result of keyValue()
+
+	void updateHash();
 public:
 	String();
 	String( const char* pString );
 	String( const String& pString );
 	String( const CharList& pList );
 	String( const char pChar );
+	explicit String( const StringSpan& pSpan );
 	//String( const uint pValue ); //I wonder what kind of effect I'd have using just int
 	//String( const int pValue ); // DEPRECATED - use CharList(const int)
 	//String( const float pValue ); // DEPRECATED - use CharList(const float)
@@ -64,6 +89,7 @@ public:
 	bool equals( const String& pString ) const;
 	bool equals( const CharList& pList ) const;
 	bool equals( const char* pString ) const;
+	bool equals( const StringSpan& pSpan ) const;
 	bool equalsIgnoreCase( const String& pOther ) const;
 	int toInt() const;				// TODO: Speed up
 	unsigned long toUnsignedLong() const;
@@ -79,7 +105,7 @@ public:
 	// Needs an equalsSubString( const String&, start, end )
 	// Needs a getSubString( start, end )
 
-	// Creates a key-value to be used for hash-tables
+	// Returns the key-value to be used for hash-tables (FNV-1a, cached on each change)
 	uint keyValue() const;
 };
 
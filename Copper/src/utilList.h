@@ -4,6 +4,8 @@
 #ifndef UTILITY_LIST
 #define UTILITY_LIST
 
+#include "SlabAllocator.h"
+
 namespace util {
 
 class NodeCopyException {};
@@ -34,6 +36,16 @@ public:
 			, item( pItem )
 		{}
 
+#ifdef COPPER_USE_SLAB_ALLOCATOR
+		static void* operator new( size_t pSize ) {
+			return SlabAllocator::allocate(pSize);
+		}
+
+		static void operator delete( void* pBlock, size_t pSize ) {
+			SlabAllocator::release(pBlock, pSize);
+		}
+#endif
+
 		Node( const Node& pOther )
 		{
 			throw NodeCopyException();
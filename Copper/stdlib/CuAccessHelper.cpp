@@ -33,7 +33,9 @@ AccessHelper::getMember( util::String name, bool createIfNotFound ) {
 
 	Variable* var;
 	if ( createIfNotFound ) {
-		scope->getVariable(name, var);
+		// The name is only interned when the member must be created
+		if ( ! scope->findVariable(name, var) )
+			scope->getVariable(Symbol(name), var);
 		return var->getRawContainer();
 	} else {
 		if ( scope->findVariable(name, var) ) {
@@ -201,6 +201,12 @@ getStringFromEngineMessage(
 		errLevel = EngineErrorLevel::error;
 		return "Parameter body creation max reached.";
 
+	// ERROR
+	// Trying to pass more arguments to a built-in function than can be stored.
+	case EngineMessage::ExceededSysCallArgCountLimit:
+		errLevel = EngineErrorLevel::error;
+		return "Argument count max reached for built-in function call.";
+
 	// ERROR
 	// Stream ended before arguments could be collected for a function call.
 	case EngineMessage::ArgBodyIncomplete:
@@ -2,6 +2,13 @@
 
 #include "FileInStream.h"
 
+#ifdef COPPER_FILE_IN_STREAM_USE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 namespace Cu {
 
 FileInStream::FileInStream( const char*  filename )
@@ -9,8 +16,20 @@ FileInStream::FileInStream( const char*  filename )
 	, atEOF(false)
 	, line(1)
 	, column(0)
+	, bufferStart(0)
+	, bufferEnd(0)
+#ifdef COPPER_FILE_IN_STREAM_USE_MMAP
+	, mapped(REAL_NULL)
+	, mappedSize(0)
+	, index(0)
+	, countedIndex(0)
+#endif
 {
 	if ( filename ) {
+#ifdef COPPER_FILE_IN_STREAM_USE_MMAP
+		if ( mapFile(filename) )
+			return;
+#endif
 		rfile = fopen(filename, "r");
 		if ( !rfile )
 			atEOF = true;
@@ -18,28 +37,89 @@ FileInStream::FileInStream( const char*  filename )
 }
 
 FileInStream::~FileInStream() {
+#ifdef COPPER_FILE_IN_STREAM_USE_MMAP
+	if ( mapped ) {
+		munmap((void*)mapped, mappedSize);
+	}
+#endif
 	if ( rfile ) {
 		fclose(rfile);
 	}
 }
 
-char
-FileInStream::getNextByte() {
-	if ( ! rfile ) {
+#ifdef COPPER_FILE_IN_STREAM_USE_MMAP
+bool
+FileInStream::mapFile( const char*  filename ) {
+	// Empty files and files that are not regular (such as pipes) are read with fread() instead.
+	int fd = open(filename, O_RDONLY);
+	if ( fd < 0 )
+		return false;
+	struct stat fileStat;
+	if ( fstat(fd, &fileStat) != 0 || ! S_ISREG(fileStat.st_mode) || fileStat.st_size <= 0 ) {
+		close(fd);
+		return false;
+	}
+	void* address = mmap(REAL_NULL, (size_t)fileStat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd); // The mapping remains valid
+	if ( address == MAP_FAILED )
+		return false;
+	madvise(address, (size_t)fileStat.st_size, MADV_SEQUENTIAL);
+	mapped = (const char*)address;
+	mappedSize = (uint)fileStat.st_size;
+	return true;
+}
+
+void
+FileInStream::countLines() {
+	// Line and column are only needed for messages, so they are counted when requested.
+	for (; countedIndex < index; ++countedIndex) {
+		if ( mapped[countedIndex] == '\n' ) {
+			++line;
+			column = 0;
+		}
+		++column;
+	}
+}
+#endif
+
+bool
+FileInStream::fillBuffer() {
+	if ( ! rfile || atEOF ) {
 		atEOF = true;
-		return ' ';
+		return false;
 	}
-	int c = fgetc(rfile);
-	if ( c == EOF  ) {
+	bufferStart = 0;
+	bufferEnd = (uint)fread(buffer, 1, BufferSize, rfile);
+	if ( bufferEnd == 0 ) {
 		atEOF = true;
+		return false;
+	}
+	return true;
+}
+
+char
+FileInStream::getNextByte() {
+#ifdef COPPER_FILE_IN_STREAM_USE_MMAP
+	if ( mapped ) {
+		if ( index == mappedSize ) {
+			atEOF = true;
+			return ' ';
+		}
+		++index;
+		return mapped[index - 1];
+	}
+#endif
+	if ( bufferStart == bufferEnd && ! fillBuffer() ) {
 		return ' ';
 	}
+	char c = buffer[bufferStart];
+	++bufferStart;
 	if ( c == '\n' ) {
 		++line;
 		column = 0;
 	}
 	++column;
-	return char(c);
+	return c;
 }
 
 bool
@@ -47,13 +127,58 @@ FileInStream::atEOS() {
 	return atEOF;
 }
 
+uint
+FileInStream::peekBlock( const char*&  pBlock ) {
+#ifdef COPPER_FILE_IN_STREAM_USE_MMAP
+	if ( mapped ) {
+		if ( index == mappedSize ) {
+			atEOF = true;
+			return 0;
+		}
+		pBlock = mapped + index;
+		return mappedSize - index;
+	}
+#endif
+	if ( bufferStart == bufferEnd && ! fillBuffer() ) {
+		return 0;
+	}
+	pBlock = buffer + bufferStart;
+	return bufferEnd - bufferStart;
+}
+
+void
+FileInStream::skipBytes( uint  pCount ) {
+#ifdef COPPER_FILE_IN_STREAM_USE_MMAP
+	if ( mapped ) {
+		index += pCount;
+		return;
+	}
+#endif
+	const uint end = bufferStart + pCount;
+	for (; bufferStart < end; ++bufferStart) {
+		if ( buffer[bufferStart] == '\n' ) {
+			++line;
+			column = 0;
+		}
+		++column;
+	}
+}
+
 UInteger
 FileInStream::getLine() {
+#ifdef COPPER_FILE_IN_STREAM_USE_MMAP
+	if ( mapped )
+		countLines();
+#endif
 	return line;
 }
 
 UInteger
 FileInStream::getColumn() {
+#ifdef COPPER_FILE_IN_STREAM_USE_MMAP
+	if ( mapped )
+		countLines();
+#endif
 	return column;
 }
 
@@ -6,21 +6,51 @@
 #include <cstdio>
 #include "../src/Copper.h"
 
+// Uncomment to map files into memory (on Linux and Unix) rather than read them into a buffer.
+// The whole file is then given to the lexer as one block.
+#if defined(__linux__) || defined(__unix__) || defined(__APPLE__)
+#define COPPER_FILE_IN_STREAM_USE_MMAP
+#endif
+
+#ifdef UNDEF_COPPER_FILE_IN_STREAM_USE_MMAP
+#undef COPPER_FILE_IN_STREAM_USE_MMAP
+#endif
+
 namespace Cu {
 
 //! File-In-Stream
-/* A safe, convenient reader for a stream. */
+/* A safe, convenient reader for a stream.
+The file is mapped into memory if possible. Otherwise, it is read in blocks of BufferSize bytes. */
 class FileInStream : public ByteStream {
+	static const uint BufferSize = 4096;
+
 	std::FILE*  rfile;
 	bool  atEOF;
 	UInteger  line;
 	UInteger  column;
+	char  buffer[BufferSize];
+	uint  bufferStart; // Index of the next unread byte
+	uint  bufferEnd;
+
+#ifdef COPPER_FILE_IN_STREAM_USE_MMAP
+	const char*  mapped; // Null if the file is not mapped
+	uint  mappedSize;
+	uint  index; // Index of the next unread byte of the mapped file
+	uint  countedIndex; // Bytes of the mapped file included in line and column
+
+	bool mapFile( const char*  filename );
+	void countLines();
+#endif
+
+	bool fillBuffer();
 
 public:
 	FileInStream( const char*  filename );
 	~FileInStream();
 	virtual char getNextByte();
 	virtual bool atEOS();
+	virtual uint peekBlock( const char*&  pBlock );
+	virtual void skipBytes( uint  pCount );
 	UInteger getLine();
 	UInteger getColumn();
 };
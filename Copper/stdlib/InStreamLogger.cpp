@@ -362,9 +362,9 @@ InStreamLogger::printToken( const Cu::Token&  token ) {
 
 	if ( printNaturalTokens ) {
 		if ( outFile == stdout )
-			fprintf(outFile, "\33[45m%s \33[0m", token.name.c_str());
+			fprintf(outFile, "\33[45m%s \33[0m", token.getText().c_str());
 		else
-			fprintf(outFile, "%s ", token.name.c_str());
+			fprintf(outFile, "%s ", token.getText().c_str());
 	} else {
 		if ( outFile == stdout )
 			fprintf(outFile, "\33[45m Type = %u\33 [0m", (UInteger)token.type);
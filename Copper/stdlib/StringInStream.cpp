@@ -7,6 +7,7 @@ namespace Cu {
 StringInStream::StringInStream( const char*  code )
 	: source(code)
 	, index(0)
+	, countedIndex(0)
 	, line(1)
 	, column(0)
 {}
@@ -14,6 +15,7 @@ StringInStream::StringInStream( const char*  code )
 StringInStream::StringInStream( const util::String&  code )
 	: source(code)
 	, index(0)
+	, countedIndex(0)
 	, line(1)
 	, column(0)
 {}
@@ -23,14 +25,8 @@ StringInStream::getNextByte() {
 	if ( atEOS() )
 		return ' ';
 
-	char c = source[index];
-	if ( c == '\n' ) {
-		++line;
-		column = 0;
-	}
-	++column;
 	++index;
-	return c;
+	return source[index - 1];
 }
 
 bool
@@ -38,13 +34,41 @@ StringInStream::atEOS() {
 	return !( source.size() > 0 && index < source.size());
 }
 
+uint
+StringInStream::peekBlock( const char*&  pBlock ) {
+	if ( atEOS() )
+		return 0;
+	pBlock = source.c_str() + index;
+	return source.size() - index;
+}
+
+void
+StringInStream::skipBytes( uint  pCount ) {
+	index += pCount;
+}
+
+void
+StringInStream::countLines() {
+	// Line and column are only needed for messages, so they are counted when requested.
+	const char* bytes = source.c_str();
+	for (; countedIndex < index; ++countedIndex) {
+		if ( bytes[countedIndex] == '\n' ) {
+			++line;
+			column = 0;
+		}
+		++column;
+	}
+}
+
 UInteger
 StringInStream::getLine() {
+	countLines();
 	return line;
 }
 
 UInteger
 StringInStream::getColumn() {
+	countLines();
 	return column;
 }
 
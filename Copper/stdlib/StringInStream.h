@@ -13,15 +13,20 @@ namespace Cu {
 class StringInStream : public ByteStream {
 	const util::String  source;
 	UInteger  index;
+	UInteger  countedIndex; // Bytes included in line and column
 	UInteger  line;
 	UInteger  column;
 
+	void countLines();
+
 public:
 	StringInStream( const char* );
 	StringInStream( const util::String& );
 
 	virtual char getNextByte();
 	virtual bool atEOS();
+	virtual uint peekBlock( const char*&  pBlock );
+	virtual void skipBytes( uint  pCount );
 
 	UInteger getLine();
 	UInteger getColumn();
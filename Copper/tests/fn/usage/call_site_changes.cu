@@ -0,0 +1,15 @@
+v = 1
+f = [] { s = 0 i = 0 loop { if ( gt(i: 3) ) { stop } s = +(s: v:) if ( equal(i: 1) ) { v = { ret(10) } } i = +(i: 1) } ret(s:) }
+assert( equal(f() 22) )
+g = [] { ret(w:) }
+w = 5
+assert( equal(g() 5) )
+w = 6
+assert( equal(g() 6) )
+h = [] { x = 0 i = 0 loop { if ( gt(i: 1) ) { stop } x = +(x: w:) w = 1 i = +(i: 1) } ret(x:) }
+assert( equal(h() 7) )
+o = [ m = 3 ]
+k = [] { ret(o.m:) }
+assert( equal(k() 3) )
+o.m = 4
+assert( equal(k() 4) )
@@ -0,0 +1,14 @@
+f = [] { x = +(1 *(2 3)) x = +(x: 1) ret(x:) }
+assert( equal(f() 8) )
+assert( equal(f() 8) )
+s = [] { ret( concat("a" "b" "c") ) }
+assert( matching(s() "abc") )
+b = [] { ret( all(not(false) gt(3 2) matching("x" "x")) ) }
+assert( b() )
+u = [n] { loop { ret(n:) } ret(0) }
+assert( equal(u(5) 5) )
+# Division by zero is not folded, so unreachable calls never run #
+d = [c] { if ( c: ) { ret(/(1 0)) } ret(1) }
+assert( equal(d(false) 1) )
+m = [c] { if ( c: ) { ret(%(1 0)) } ret(1) }
+assert( equal(m(false) 1) )
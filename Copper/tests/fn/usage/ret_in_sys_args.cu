@@ -0,0 +1,4 @@
+a = { +(1 ret(5)) }
+b = [p] { ret( +(p: a()) ) }
+assert( equal(b(10) 15) )
+assert( equal(+(1 a:) 6) )
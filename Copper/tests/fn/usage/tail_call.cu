@@ -0,0 +1,24 @@
+count = [n acc] { if ( lte(n: 0) ) { ret(acc:) } ret( count(-(n: 1) +(acc: 1)) ) }
+assert( equal(count(100000 0) 100000) )
+even = [n] { if ( equal(n: 0) ) { ret(true) } ret( odd(-(n: 1)) ) }
+odd = [n] { if ( equal(n: 0) ) { ret(false) } ret( even(-(n: 1)) ) }
+assert( odd(10001) )
+last = [n] { if ( gt(n: 0) ) { last(-(n: 1)) } else { 7 } }
+assert( equal(last(1000) 7) )
+a = [n] { b = [m] { ret(+(m: 1)) } ret( b(n:) ) }
+assert( equal(a(1) 2) )
+# Functions passed by pointer from the caller's variables must outlive the caller #
+g = [p] { ret(p()) }
+f = { q = { ret(5) } ret(g(q)) }
+assert( equal(f() 5) )
+m = [p] { ret(p.x:) }
+f = { q = [x=9] {} ret(m(q)) }
+assert( equal(f() 9) )
+h = [p] { ret(is_owner(p)) }
+f = { q = {} ret(h(q)) }
+assert( not(f()) )
+# Functions called from the caller's variables keep "super" #
+f = { o = [v=4 x={ ret(super.v:) }] ret(o.x()) }
+assert( equal(f() 4) )
+f = { o = [v=4 x={ ret(super.v:) }] o.x() }
+assert( equal(f() 4) )
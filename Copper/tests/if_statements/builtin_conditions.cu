@@ -0,0 +1,15 @@
+cmp = [a b] { r = 0 if ( lt(a: b:) ) { r = +(r: 1) } if ( lte(a: b:) ) { r = +(r: 2) } if ( gt(a: b:) ) { r = +(r: 4) } if ( gte(a: b:) ) { r = +(r: 8) } if ( equal(a: b:) ) { r = +(r: 16) } ret(r:) }
+assert( equal(cmp(1 1) 26) )
+assert( equal(cmp(1 2) 3) )
+assert( equal(cmp(2 1) 12) )
+assert( equal(cmp(1.5 1) 12) )
+logic = [a b] { if ( all(a: b:) ) { ret(1) } elif ( any(a: b:) ) { ret(2) } elif ( not(a:) ) { ret(3) } ret(4) }
+assert( equal(logic(true true) 1) )
+assert( equal(logic(false true) 2) )
+assert( equal(logic(false false) 3) )
+str = [s] { if ( matching(s: "a") ) { ret(1) } ret(2) }
+assert( equal(str("a") 1) )
+assert( equal(str("b") 2) )
+last = [n] { if ( gt(n: 0) ) { } }
+assert( last(1) )
+assert( not(last(0)) )
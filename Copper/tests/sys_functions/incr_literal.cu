@@ -0,0 +1,18 @@
+i = 0
+loop {
+	if ( gte(i: 2) ) { stop }
+	i = +(i: 1)
+	assert( equal(++(5) 6) )
+	assert( equal(--(2.5) 1.5) )
+	l = list(1 2.5)
+	++(item_at(l: 0))
+	--(item_at(l: 1))
+	assert( equal(item_at(l: 0) 2) )
+	assert( equal(item_at(l: 1) 1.5) )
+	append(l: 7)
+	replace(l: 0 10)
+	++(item_at(l: 2))
+	++(item_at(l: 0))
+	assert( equal(item_at(l: 2) 8) )
+	assert( equal(item_at(l: 0) 11) )
+}